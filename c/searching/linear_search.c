@@ -10,9 +10,133 @@
  * 
  * Best Case: O(1) - element found at first position
  * Worst Case: O(n) - element at last position or not present
+ *
+ * Implementation note:
+ * On x86 with GCC or Clang the scan compares 4 (SSE2), 8 (AVX2) or
+ * 16 (AVX-512) ints per instruction. The best kernel for the CPU is chosen
+ * once at program startup; other targets use the plain loop.
+ * All versions return the index of the first match.
  */
 
 #include <stdio.h>
+#include <stdlib.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define HAVE_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+/**
+ * Plain loop, used for small arrays, tails and non-x86 targets
+ */
+static int linear_search_scalar(const int arr[], int size, int target) {
+    for (int i = 0; i < size; i++) {
+        if (arr[i] == target) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#ifdef HAVE_X86_SIMD
+
+/**
+ * SSE2: 4 ints per compare, movemask gives one bit per int
+ */
+__attribute__((target("sse2")))
+static int linear_search_sse2(const int arr[], int size, int target) {
+    __m128i needle = _mm_set1_epi32(target);
+    int i = 0;
+
+    for (; i + 4 <= size; i += 4) {
+        __m128i c = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(arr + i)), needle);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(c));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    int tail = linear_search_scalar(arr + i, size - i, target);
+    return tail < 0 ? -1 : i + tail;
+}
+
+/**
+ * AVX2: 8 ints per compare, two vectors per iteration
+ */
+__attribute__((target("avx2")))
+static int linear_search_avx2(const int arr[], int size, int target) {
+    __m256i needle = _mm256_set1_epi32(target);
+    int i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        __m256i c0 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i)), needle);
+        __m256i c1 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(arr + i + 8)), needle);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(c0))
+                 | (_mm256_movemask_ps(_mm256_castsi256_ps(c1)) << 8);
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    int tail = linear_search_sse2(arr + i, size - i, target);
+    return tail < 0 ? -1 : i + tail;
+}
+
+/**
+ * AVX-512: 16 ints per compare, tail handled with a masked load
+ */
+__attribute__((target("avx512f")))
+static int linear_search_avx512(const int arr[], int size, int target) {
+    __m512i needle = _mm512_set1_epi32(target);
+
+    for (int i = 0; i < size; i += 16) {
+        int left = size - i;
+        __mmask16 valid = left >= 16 ? (__mmask16)0xFFFF : (__mmask16)((1u << left) - 1);
+        __m512i values = _mm512_maskz_loadu_epi32(valid, arr + i);
+        __mmask16 mask = _mm512_mask_cmpeq_epi32_mask(valid, values, needle);
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    return -1;
+}
+
+#endif
+
+typedef int (*search_fn)(const int[], int, int);
+
+/**
+ * Picks the best kernel supported by this CPU
+ */
+static search_fn select_kernel(void) {
+#ifdef HAVE_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return linear_search_avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return linear_search_avx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return linear_search_sse2;
+    }
+#endif
+    return linear_search_scalar;
+}
+
+/*
+ * Kernel used by linear_search(). It is chosen once, before main() runs
+ * (and before any thread exists), so calls from many threads only read it.
+ */
+static search_fn linear_search_kernel = linear_search_scalar;
+
+#ifdef HAVE_X86_SIMD
+__attribute__((constructor))
+static void linear_search_init(void) {
+    linear_search_kernel = select_kernel();
+}
+#endif
 
 /**
  * Performs linear search on an array
@@ -27,14 +151,7 @@ int linear_search(int arr[], int size, int target) {
         return -1;
     }
     
-    // Iterate through each element
-    for (int i = 0; i < size; i++) {
-        if (arr[i] == target) {
-            return i;  // Element found, return index
-        }
-    }
-    
-    return -1;  // Element not found
+    return linear_search_kernel(arr, size, target);
 }
 
 // Example usage and test cases
@@ -98,6 +215,28 @@ int main() {
     printf("Result: %s at index %d\n\n", 
            result6 != -1 ? "Found" : "Not Found", result6);
     
+    // Test Case 7: Large array, every position checked against the plain loop
+    int size7 = 1000;
+    int *arr7 = malloc(size7 * sizeof(int));
+    if (arr7 == NULL) {
+        fprintf(stderr, "Test 7: out of memory\n");
+        return 1;
+    }
+    int matches = 1;
+    for (int i = 0; i < size7; i++) {
+        arr7[i] = i % 100;  // repeated values: first match must win
+    }
+    for (int target = -1; target <= 100; target++) {
+        for (int size = 0; size <= size7; size += 37) {
+            if (linear_search(arr7, size, target) != linear_search_scalar(arr7, size, target)) {
+                matches = 0;
+            }
+        }
+    }
+    free(arr7);
+    printf("Test 7 - SIMD search vs plain loop:\n");
+    printf("Every size and target match: %s\n\n", matches ? "yes" : "no");
+    
     return 0;
 }
 
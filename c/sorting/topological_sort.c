@@ -19,7 +19,7 @@
 
 #include <stdio.h>
 
-const int max_vertices = 10;
+enum { max_vertices = 10 };  // constant expression, so the arrays below are not VLAs
 
 /**
  * Performs topological sort on a directed graph
@@ -0,0 +1,210 @@
+/*
+ * Benchmark Harness
+ *
+ * Description:
+ * Times one piece of code many times and summarizes the samples:
+ *   1. setup() prepares the input (not timed), e.g. copies an unsorted array
+ *   2. body() runs once per sample and is timed with steady_clock
+ *   3. the first warmup_runs samples are dropped (cold caches, page faults)
+ *   4. sampling stops after min_runs samples once min_seconds of body time
+ *      has been measured, or after max_runs samples
+ * Results report min / median / p90 / p99 / max / mean per sample and the
+ * throughput at the median, and are written as JSON so runs on different
+ * commits or machines can be compared with any JSON tool.
+ *
+ * Time Complexity: O(runs * cost of one run)
+ * Space Complexity: O(runs) samples
+ */
+
+#ifndef ALGOVAULT_BENCHMARK_BENCHMARK_H
+#define ALGOVAULT_BENCHMARK_BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <ctime>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef ALGOVAULT_GIT_COMMIT
+#define ALGOVAULT_GIT_COMMIT "unknown"
+#endif
+
+/**
+ * Keeps the compiler from removing a computation whose result is unused
+ */
+template <typename T>
+inline void do_not_optimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * How many samples to take
+ */
+struct BenchmarkConfig {
+    std::size_t warmup_runs = 1;
+    std::size_t min_runs = 5;
+    std::size_t max_runs = 1000;
+    double min_seconds = 0.2;
+};
+
+/**
+ * Summary of the samples of one benchmark (times in nanoseconds)
+ * - items: elements processed per run, for throughput
+ */
+struct BenchmarkResult {
+    std::string group;
+    std::string algorithm;
+    std::string workload;
+    std::size_t size = 0;
+    std::size_t items = 0;
+    std::size_t runs = 0;
+    double min_ns = 0;
+    double median_ns = 0;
+    double p90_ns = 0;
+    double p99_ns = 0;
+    double max_ns = 0;
+    double mean_ns = 0;
+
+    /**
+     * @return items per second at the median time
+     */
+    double items_per_second() const { return median_ns > 0 ? items * 1e9 / median_ns : 0; }
+};
+
+/**
+ * p-th percentile (0..100) of sorted samples, nearest rank
+ */
+inline double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    std::size_t rank = static_cast<std::size_t>(p / 100.0 * static_cast<double>(sorted.size()) + 0.5);
+    rank = std::min(std::max<std::size_t>(rank, 1), sorted.size());
+    return sorted[rank - 1];
+}
+
+/**
+ * Runs and times a benchmark
+ *
+ * @param group, algorithm, workload: names reported in the result
+ * @param size: input size (elements, vertices, ...)
+ * @param items: elements processed per run, for throughput
+ * @param config: warm-up and sample counts
+ * @param setup: called before every run, not timed
+ * @param body: the code to time
+ * @return summary of the samples
+ */
+template <typename Setup, typename Body>
+BenchmarkResult run_benchmark(const std::string& group, const std::string& algorithm,
+                              const std::string& workload, std::size_t size, std::size_t items,
+                              const BenchmarkConfig& config, Setup&& setup, Body&& body) {
+    std::vector<double> samples;
+    double measured = 0;
+    for (std::size_t run = 0; run < config.warmup_runs + config.max_runs; run++) {
+        setup();
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        const auto stop = std::chrono::steady_clock::now();
+        if (run < config.warmup_runs) {
+            continue;
+        }
+        const double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+        samples.push_back(ns);
+        measured += ns;
+        if (samples.size() >= config.min_runs && measured >= config.min_seconds * 1e9) {
+            break;
+        }
+    }
+
+    BenchmarkResult result;
+    result.group = group;
+    result.algorithm = algorithm;
+    result.workload = workload;
+    result.size = size;
+    result.items = items;
+    result.runs = samples.size();
+    std::sort(samples.begin(), samples.end());
+    result.min_ns = samples.front();
+    result.median_ns = percentile(samples, 50);
+    result.p90_ns = percentile(samples, 90);
+    result.p99_ns = percentile(samples, 99);
+    result.max_ns = samples.back();
+    result.mean_ns = measured / static_cast<double>(samples.size());
+    return result;
+}
+
+/**
+ * String as a JSON string literal
+ */
+inline std::string json_string(const std::string& text) {
+    std::string out = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out += escaped;
+        } else {
+            out += c;
+        }
+    }
+    return out + "\"";
+}
+
+/**
+ * Describes the machine and build, so results can be told apart
+ */
+struct BenchmarkContext {
+    std::string label;
+    std::string git_commit = ALGOVAULT_GIT_COMMIT;
+    std::string compiler = __VERSION__;
+    std::string cpu_features;
+    unsigned hardware_threads = std::thread::hardware_concurrency();
+#ifdef NDEBUG
+    bool assertions = false;
+#else
+    bool assertions = true;
+#endif
+};
+
+/**
+ * Writes results as one JSON document:
+ *     {"context": {...}, "results": [{...}, ...]}
+ */
+inline void write_json(std::ostream& out, const BenchmarkContext& context,
+                       const std::vector<BenchmarkResult>& results) {
+    char date[32];
+    const std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+    out << "{\n  \"context\": {\n"
+        << "    \"label\": " << json_string(context.label) << ",\n"
+        << "    \"date\": " << json_string(date) << ",\n"
+        << "    \"git_commit\": " << json_string(context.git_commit) << ",\n"
+        << "    \"compiler\": " << json_string(context.compiler) << ",\n"
+        << "    \"cpu_features\": " << json_string(context.cpu_features) << ",\n"
+        << "    \"hardware_threads\": " << context.hardware_threads << ",\n"
+        << "    \"assertions\": " << (context.assertions ? "true" : "false") << "\n"
+        << "  },\n  \"results\": [";
+    for (std::size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult& r = results[i];
+        out << (i == 0 ? "\n" : ",\n")
+            << "    {\"group\": " << json_string(r.group)
+            << ", \"algorithm\": " << json_string(r.algorithm)
+            << ", \"workload\": " << json_string(r.workload)
+            << ", \"size\": " << r.size << ", \"items\": " << r.items << ", \"runs\": " << r.runs
+            << ", \"min_ns\": " << r.min_ns << ", \"median_ns\": " << r.median_ns
+            << ", \"p90_ns\": " << r.p90_ns << ", \"p99_ns\": " << r.p99_ns
+            << ", \"max_ns\": " << r.max_ns << ", \"mean_ns\": " << r.mean_ns
+            << ", \"items_per_second\": " << r.items_per_second() << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+#endif // ALGOVAULT_BENCHMARK_BENCHMARK_H
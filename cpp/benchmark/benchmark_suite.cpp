@@ -0,0 +1,385 @@
+/*
+ * AlgoVault Benchmark Suite
+ *
+ * Description:
+ * Measures the algorithms of the repository on generated workloads
+ * (workloads.h) over a sweep of sizes, with warm-up, repeated runs and
+ * percentile timings (benchmark.h):
+ *
+ *   sorting:    bubble_sort, insertion_sort (quadratic, small sizes);
+ *               std::sort, pdq_sort, radix_sort as O(n log n) references;
+ *               on random, sorted, reversed and few-unique arrays;
+ *               insertion_sort, std::sort and small_sort (sorting networks)
+ *               on many rows of 8, 16 and 32 elements
+ *   searching:  linear_search (scalar and SIMD kernels), target absent
+ *               (full scan) or at a random position
+ *   graph:      bfs (adjacency list, CSR, CSR with a reused workspace) on
+ *               Erdos-Renyi and R-MAT graphs; topological_sort (adjacency
+ *               list, CSR) on random DAGs
+ *
+ * Every result is also checked (sorted output, same traversal, valid
+ * order); a failed check prints WRONG.
+ *
+ * The C versions (c/sorting/bubble_sort.c, c/searching/linear_search.c)
+ * are measured when built with ALGOVAULT_BENCHMARK_C and linked in, their
+ * main() renamed:
+ *     gcc -O2 -std=c99 -c -Dmain=c_bubble_sort_main c/sorting/bubble_sort.c
+ *     gcc -O2 -std=c99 -c -Dmain=c_linear_search_main c/searching/linear_search.c
+ *     g++ -O2 -std=c++17 -pthread -DALGOVAULT_BENCHMARK_C \
+ *         cpp/benchmark/benchmark_suite.cpp bubble_sort.o linear_search.o
+ * c/graph/bfs.c and c/sorting/topological_sort.c print inside the
+ * algorithm on fixed-size matrices and are not measured.
+ *
+ * Built with -DALGOVAULT_PERF, the suite also prints the counters of every
+ * instrumented region (cpp/profiling/perf_counters.h) summed over all runs.
+ *
+ * Usage:
+ *     ./benchmark_suite [--quick] [--filter TEXT] [--json FILE] [--label NAME]
+ *                       [--min-time SECONDS]
+ *   --quick      smaller size sweep
+ *   --filter     only benchmarks whose "group/algorithm/workload" contains TEXT
+ *   --json       write results to FILE ("-" for stdout)
+ *   --label      name stored with the results (e.g. branch or machine)
+ *   --min-time   seconds of samples per benchmark (default 0.2)
+ *
+ * Time Complexity: depends on the sweep (about a minute for the full one)
+ * Space Complexity: O(largest workload)
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "../graph/bfs.h"
+#include "../graph/csr_graph.h"
+#include "../profiling/perf_counters.h"
+#include "../searching/simd_linear_search.h"
+#include "../sorting/bubble_sort.h"
+#include "../sorting/insertion_sort.h"
+#include "../sorting/pdq_sort.h"
+#include "../sorting/radix_sort.h"
+#include "../sorting/sorting_network.h"
+#include "../sorting/topological_sort.h"
+#include "benchmark.h"
+#include "workloads.h"
+using namespace std;
+
+#ifdef ALGOVAULT_BENCHMARK_C
+namespace c_version {
+extern "C" {
+void bubble_sort(int arr[], int size);
+int linear_search(int arr[], int size, int target);
+}
+}  // namespace c_version
+#endif
+
+/**
+ * Command line settings and collected results
+ */
+struct Suite {
+    bool quick = false;
+    string filter;
+    BenchmarkConfig config;
+    vector<BenchmarkResult> results;
+    bool all_correct = true;
+    FILE* table = stdout;
+
+    bool selected(const string& group, const string& algorithm, const string& workload) const {
+        return (group + "/" + algorithm + "/" + workload).find(filter) != string::npos;
+    }
+
+    /**
+     * Runs one benchmark if it matches the filter, prints and stores its result
+     */
+    template <typename Setup, typename Body>
+    void run(const string& group, const string& algorithm, const string& workload, size_t size,
+             size_t items, Setup&& setup, Body&& body) {
+        if (!selected(group, algorithm, workload)) {
+            return;
+        }
+        BenchmarkResult r = run_benchmark(group, algorithm, workload, size, items, config, setup, body);
+        fprintf(table, "%-10s %-26s %-12s %9zu %12.3f %12.3f %12.3f %10.2f\n", group.c_str(),
+               algorithm.c_str(), workload.c_str(), size, r.median_ns / 1e6, r.p90_ns / 1e6,
+               r.p99_ns / 1e6, r.items_per_second() / 1e6);
+        fflush(table);
+        results.push_back(r);
+    }
+
+    void check(bool correct, const string& what) {
+        if (!correct) {
+            fprintf(table, "WRONG result: %s\n", what.c_str());
+            all_correct = false;
+        }
+    }
+};
+
+/**
+ * Sorting algorithms on every array shape
+ */
+void sorting_benchmarks(Suite& suite) {
+    using SortFn = function<void(vector<int>&)>;
+    struct Algorithm {
+        const char* name;
+        SortFn sort;
+        bool quadratic;
+    };
+    vector<Algorithm> algorithms = {
+        {"bubble_sort", [](vector<int>& a) { bubble_sort(a.begin(), a.end()); }, true},
+        {"insertion_sort", [](vector<int>& a) { insertion_sort(a.begin(), a.end()); }, true},
+#ifdef ALGOVAULT_BENCHMARK_C
+        {"c_bubble_sort", [](vector<int>& a) { c_version::bubble_sort(a.data(), static_cast<int>(a.size())); }, true},
+#endif
+        {"std_sort", [](vector<int>& a) { sort(a.begin(), a.end()); }, false},
+        {"pdq_sort", [](vector<int>& a) { pdq_sort(a.begin(), a.end()); }, false},
+        {"radix_sort", [](vector<int>& a) { radix_sort(a.begin(), a.end()); }, false},
+    };
+    const vector<size_t> quadratic_sizes = suite.quick ? vector<size_t>{1000, 4000}
+                                                       : vector<size_t>{1000, 2000, 4000, 8000};
+    const vector<size_t> fast_sizes = suite.quick ? vector<size_t>{10000, 100000}
+                                                  : vector<size_t>{10000, 100000, 1000000};
+
+    for (ArrayShape shape : {ArrayShape::kRandom, ArrayShape::kSorted, ArrayShape::kReversed,
+                             ArrayShape::kFewUnique}) {
+        for (const Algorithm& algorithm : algorithms) {
+            for (size_t n : algorithm.quadratic ? quadratic_sizes : fast_sizes) {
+                if (!suite.selected("sorting", algorithm.name, array_shape_name(shape))) {
+                    continue;
+                }
+                const vector<int> input = make_array(shape, n);
+                vector<int> work;
+                suite.run("sorting", algorithm.name, array_shape_name(shape), n, n,
+                          [&] { work = input; }, [&] { algorithm.sort(work); });
+                suite.check(is_sorted(work.begin(), work.end()),
+                            string(algorithm.name) + " " + array_shape_name(shape));
+            }
+        }
+    }
+
+    // Many tiny arrays: every row of a random array is sorted on its own
+    const size_t kRows = suite.quick ? 10000 : 100000;
+    vector<pair<const char*, function<void(int*, int*)>>> row_sorts = {
+        {"insertion_sort", [](int* first, int* last) { insertion_sort(first, last); }},
+        {"std_sort", [](int* first, int* last) { sort(first, last); }},
+        {"small_sort", [](int* first, int* last) { small_sort(first, last); }},
+    };
+    for (size_t row : {size_t{8}, size_t{16}, size_t{32}}) {
+        const string workload = "rows_" + to_string(row);
+        const vector<int> input = make_array(ArrayShape::kRandom, kRows * row);
+        for (const auto& row_sort : row_sorts) {
+            if (!suite.selected("sorting", row_sort.first, workload)) {
+                continue;
+            }
+            vector<int> work;
+            suite.run("sorting", row_sort.first, workload, row, kRows * row, [&] { work = input; }, [&] {
+                for (size_t i = 0; i < work.size(); i += row) {
+                    row_sort.second(work.data() + i, work.data() + i + row);
+                }
+            });
+            bool rows_sorted = true;
+            for (size_t i = 0; i < work.size(); i += row) {
+                rows_sorted = rows_sorted && is_sorted(work.begin() + i, work.begin() + i + row);
+            }
+            suite.check(rows_sorted, string(row_sort.first) + " " + workload);
+        }
+    }
+}
+
+/**
+ * Linear search kernels; every run does kQueries searches
+ */
+void searching_benchmarks(Suite& suite) {
+    const size_t kQueries = 16;
+    using SearchFn = function<ptrdiff_t(const vector<int>&, int)>;
+    vector<pair<string, SearchFn>> algorithms = {
+        {"linear_search_scalar",
+         [](const vector<int>& a, int x) { return linear_search_scalar(a.data(), a.size(), x); }},
+        {string("linear_search_") + simd_level_name(detect_simd_level()),
+         [](const vector<int>& a, int x) { return linear_search_simd(a.data(), a.size(), x); }},
+#ifdef ALGOVAULT_BENCHMARK_C
+        {"c_linear_search",
+         [](const vector<int>& a, int x) -> ptrdiff_t {
+             return c_version::linear_search(const_cast<int*>(a.data()), static_cast<int>(a.size()), x);
+         }},
+#endif
+    };
+    const vector<size_t> sizes = suite.quick ? vector<size_t>{1000, 65536}
+                                             : vector<size_t>{1000, 65536, 1048576};
+
+    for (size_t n : sizes) {
+        // Distinct values 0 .. n - 1 in random order; -1 is never present
+        vector<int> data(n);
+        for (size_t i = 0; i < n; i++) {
+            data[i] = static_cast<int>(i);
+        }
+        shuffle(data.begin(), data.end(), mt19937(7));
+        mt19937 rng(8);
+        vector<int> hits(kQueries);
+        size_t hit_items = 0;
+        for (int& target : hits) {
+            size_t position = rng() % n;
+            target = data[position];
+            hit_items += position + 1;
+        }
+        vector<int> misses(kQueries, -1);
+
+        for (const auto& algorithm : algorithms) {
+            for (const auto& workload : {make_pair("miss", &misses), make_pair("hit_random", &hits)}) {
+                const vector<int>& targets = *workload.second;
+                const bool miss = targets[0] < 0;
+                ptrdiff_t checksum = 0;
+                suite.run("searching", algorithm.first, workload.first, n, miss ? kQueries * n : hit_items,
+                          [&] { checksum = 0; },
+                          [&] {
+                              for (int target : targets) {
+                                  checksum += algorithm.second(data, target);
+                              }
+                              do_not_optimize(checksum);
+                          });
+                if (suite.selected("searching", algorithm.first, workload.first)) {
+                    bool correct = true;
+                    for (int target : targets) {
+                        ptrdiff_t i = algorithm.second(data, target);
+                        correct = correct && (miss ? i == -1 : data[static_cast<size_t>(i)] == target);
+                    }
+                    suite.check(correct, algorithm.first + " " + workload.first);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * BFS on random and R-MAT graphs, topological sort on random DAGs
+ */
+void graph_benchmarks(Suite& suite) {
+    const vector<int> scales = suite.quick ? vector<int>{14, 17} : vector<int>{14, 17, 20};
+    const int kEdgeFactor = 8;
+
+    for (int scale : scales) {
+        const int n = 1 << scale;
+        const pair<const char*, EdgeList> graphs[] = {
+            {"erdos_renyi", symmetrize(erdos_renyi_edges(n, static_cast<size_t>(n) * kEdgeFactor / 2))},
+            {"rmat", symmetrize(rmat_edges(scale, kEdgeFactor / 2))},
+        };
+        for (const auto& graph_input : graphs) {
+            const char* workload = graph_input.first;
+            if (!suite.selected("graph", "bfs_adjacency", workload) && !suite.selected("graph", "bfs_csr", workload) &&
+                !suite.selected("graph", "bfs_csr_workspace", workload)) {
+                continue;
+            }
+            CSRGraph<int> graph = CSRGraph<int>::from_edge_list(n, graph_input.second);
+            const vector<vector<int>> adj = graph.to_adjacency_list();
+            // Start at the highest degree vertex: it is in the giant component
+            int source = 0;
+            for (int v = 1; v < n; v++) {
+                source = graph.degree(v) > graph.degree(source) ? v : source;
+            }
+            const size_t items = static_cast<size_t>(graph.num_edges());
+            const vector<int> expected = bfs(source, adj, n);
+            vector<int> traversal;
+            BFSWorkspace<int> workspace(n);
+
+            suite.run("graph", "bfs_adjacency", workload, static_cast<size_t>(n), items, [] {},
+                      [&] { traversal = bfs(source, adj, n); });
+            suite.check(traversal == expected || !suite.selected("graph", "bfs_adjacency", workload),
+                        "bfs_adjacency");
+            suite.run("graph", "bfs_csr", workload, static_cast<size_t>(n), items, [] {},
+                      [&] { traversal = bfs(source, graph); });
+            suite.check(traversal == expected || !suite.selected("graph", "bfs_csr", workload), "bfs_csr");
+            suite.run("graph", "bfs_csr_workspace", workload, static_cast<size_t>(n), items, [] {},
+                      [&] { bfs(source, graph, workspace, traversal); });
+            suite.check(traversal == expected || !suite.selected("graph", "bfs_csr_workspace", workload),
+                        "bfs_csr_workspace");
+        }
+
+        if (!suite.selected("graph", "topological_sort_adjacency", "random_dag") &&
+            !suite.selected("graph", "topological_sort_csr", "random_dag")) {
+            continue;
+        }
+        CSRGraph<int> dag = CSRGraph<int>::from_edge_list(n, random_dag_edges(n, static_cast<size_t>(n) * 4));
+        const vector<vector<int>> dag_adj = dag.to_adjacency_list();
+        const size_t items = static_cast<size_t>(dag.num_edges());
+        vector<int> order;
+        auto is_valid_order = [&] {
+            vector<int> position(static_cast<size_t>(n), -1);
+            for (size_t i = 0; i < order.size(); i++) {
+                position[static_cast<size_t>(order[i])] = static_cast<int>(i);
+            }
+            for (int u = 0; u < n; u++) {
+                for (int v : dag.neighbors(u)) {
+                    if (position[u] < 0 || position[v] < position[u]) {
+                        return false;
+                    }
+                }
+            }
+            return order.size() == static_cast<size_t>(n);
+        };
+        suite.run("graph", "topological_sort_adjacency", "random_dag", static_cast<size_t>(n), items,
+                  [] {}, [&] { order = topological_sort(n, dag_adj); });
+        suite.check(is_valid_order() || !suite.selected("graph", "topological_sort_adjacency", "random_dag"),
+                    "topological_sort_adjacency");
+        suite.run("graph", "topological_sort_csr", "random_dag", static_cast<size_t>(n), items, [] {},
+                  [&] { order = topological_sort(dag); });
+        suite.check(is_valid_order() || !suite.selected("graph", "topological_sort_csr", "random_dag"),
+                    "topological_sort_csr");
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Suite suite;
+    BenchmarkContext context;
+    string json_path;
+    for (int i = 1; i < argc; i++) {
+        const string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "--quick") {
+            suite.quick = true;
+        } else if (arg == "--filter" && has_value) {
+            suite.filter = argv[++i];
+        } else if (arg == "--json" && has_value) {
+            json_path = argv[++i];
+        } else if (arg == "--label" && has_value) {
+            context.label = argv[++i];
+        } else if (arg == "--min-time" && has_value) {
+            suite.config.min_seconds = atof(argv[++i]);
+        } else {
+            cerr << "usage: " << argv[0]
+                 << " [--quick] [--filter TEXT] [--json FILE] [--label NAME] [--min-time SECONDS]" << endl;
+            return 2;
+        }
+    }
+    context.cpu_features = simd_level_name(detect_simd_level());
+
+    // With --json - the table goes to stderr so stdout stays valid JSON
+    if (json_path == "-") {
+        suite.table = stderr;
+    }
+    fprintf(suite.table, "%-10s %-26s %-12s %9s %12s %12s %12s %10s\n", "group", "algorithm", "workload",
+            "size", "median_ms", "p90_ms", "p99_ms", "Mitems/s");
+    sorting_benchmarks(suite);
+    searching_benchmarks(suite);
+    graph_benchmarks(suite);
+
+    if (json_path == "-") {
+        write_json(cout, context, suite.results);
+    } else if (!json_path.empty()) {
+        ofstream out(json_path);
+        write_json(out, context, suite.results);
+        if (!out) {
+            cerr << "cannot write " << json_path << endl;
+            return 1;
+        }
+    }
+#ifdef ALGOVAULT_PERF
+    fflush(suite.table);
+    perf_report(json_path == "-" ? cerr : cout);
+#endif
+    fprintf(suite.table, "All results correct: %s\n", suite.all_correct ? "yes" : "no");
+    return suite.all_correct ? 0 : 1;
+}
@@ -0,0 +1,160 @@
+/*
+ * Benchmark Workload Generators
+ *
+ * Description:
+ * Deterministic synthetic inputs (same seed, same data on every machine):
+ *
+ *   Arrays:  random, sorted, reversed, few unique values
+ *   Graphs:  Erdos-Renyi G(n, m) (uniform random edges),
+ *            R-MAT (recursive quadrant choice with probabilities a, b, c, d:
+ *            skewed degrees like social and web graphs, Graph500 defaults),
+ *            random DAGs (edges follow a hidden random vertex order)
+ *
+ * Graph generators return directed edge lists; symmetrize() adds the
+ * reverse edges for undirected graphs.
+ *
+ * Time Complexity: O(n) per array, O(m) (R-MAT: O(m log n)) per graph
+ * Space Complexity: O(n) / O(m)
+ */
+
+#ifndef ALGOVAULT_BENCHMARK_WORKLOADS_H
+#define ALGOVAULT_BENCHMARK_WORKLOADS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Array shapes for sorting and searching benchmarks
+ */
+enum class ArrayShape { kRandom, kSorted, kReversed, kFewUnique };
+
+inline const char* array_shape_name(ArrayShape shape) {
+    switch (shape) {
+        case ArrayShape::kRandom: return "random";
+        case ArrayShape::kSorted: return "sorted";
+        case ArrayShape::kReversed: return "reversed";
+        default: return "few_unique";
+    }
+}
+
+/**
+ * Array of n ints with the given shape
+ * @param seed: random seed; few_unique uses 16 distinct values
+ */
+inline std::vector<int> make_array(ArrayShape shape, std::size_t n, unsigned seed = 1) {
+    std::mt19937 rng(seed);
+    std::vector<int> data(n);
+    if (shape == ArrayShape::kFewUnique) {
+        for (int& x : data) {
+            x = static_cast<int>(rng() % 16);
+        }
+        return data;
+    }
+    for (int& x : data) {
+        x = static_cast<int>(rng() >> 1);
+    }
+    if (shape == ArrayShape::kSorted) {
+        std::sort(data.begin(), data.end());
+    } else if (shape == ArrayShape::kReversed) {
+        std::sort(data.begin(), data.end(), [](int a, int b) { return a > b; });
+    }
+    return data;
+}
+
+using EdgeList = std::vector<std::pair<int, int>>;
+
+/**
+ * Erdos-Renyi style random directed graph: m edges with uniformly random
+ * endpoints (duplicates and self-loops possible, as in G(n, m) sampling
+ * with replacement)
+ */
+inline EdgeList erdos_renyi_edges(int n, std::size_t m, unsigned seed = 1) {
+    std::mt19937_64 rng(seed);
+    EdgeList edges(m);
+    for (auto& edge : edges) {
+        edge = {static_cast<int>(rng() % static_cast<std::uint64_t>(n)),
+                static_cast<int>(rng() % static_cast<std::uint64_t>(n))};
+    }
+    return edges;
+}
+
+/**
+ * R-MAT graph with 2^scale vertices and edge_factor * 2^scale edges
+ *
+ * Every edge picks one quadrant of the adjacency matrix per bit of the
+ * vertex ids, with probabilities a, b, c and 1 - a - b - c. Vertex ids are
+ * then shuffled so that high degree vertices are not all at small ids.
+ */
+inline EdgeList rmat_edges(int scale, int edge_factor, unsigned seed = 1, double a = 0.57,
+                           double b = 0.19, double c = 0.19) {
+    if (scale < 1 || scale > 30) {
+        throw std::invalid_argument("rmat_edges: scale must be in 1..30");
+    }
+    const int n = 1 << scale;
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    EdgeList edges(static_cast<std::size_t>(n) * static_cast<std::size_t>(edge_factor));
+    for (auto& edge : edges) {
+        int u = 0;
+        int v = 0;
+        for (int bit = 0; bit < scale; bit++) {
+            const double r = coin(rng);
+            const int down = r >= a + b;                                // quadrant c or d
+            const int right = (r >= a && r < a + b) || r >= a + b + c;  // quadrant b or d
+            u |= down << bit;
+            v |= right << bit;
+        }
+        edge = {u, v};
+    }
+
+    std::vector<int> relabel(static_cast<std::size_t>(n));
+    std::iota(relabel.begin(), relabel.end(), 0);
+    std::shuffle(relabel.begin(), relabel.end(), rng);
+    for (auto& edge : edges) {
+        edge = {relabel[edge.first], relabel[edge.second]};
+    }
+    return edges;
+}
+
+/**
+ * Random DAG: m edges, each from an earlier to a later vertex of a random
+ * hidden order (so the identity is usually not a topological order)
+ */
+inline EdgeList random_dag_edges(int n, std::size_t m, unsigned seed = 1) {
+    std::mt19937_64 rng(seed);
+    std::vector<int> order(static_cast<std::size_t>(n));
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), rng);
+    EdgeList edges;
+    edges.reserve(m);
+    while (n > 1 && edges.size() < m) {
+        std::size_t i = static_cast<std::size_t>(rng() % static_cast<std::uint64_t>(n));
+        std::size_t j = static_cast<std::size_t>(rng() % static_cast<std::uint64_t>(n));
+        if (i != j) {
+            edges.push_back({order[std::min(i, j)], order[std::max(i, j)]});
+        }
+    }
+    return edges;
+}
+
+/**
+ * Adds v -> u for every edge u -> v
+ */
+inline EdgeList symmetrize(const EdgeList& edges) {
+    EdgeList both;
+    both.reserve(edges.size() * 2);
+    for (const auto& edge : edges) {
+        both.push_back(edge);
+        both.push_back({edge.second, edge.first});
+    }
+    return both;
+}
+
+#endif // ALGOVAULT_BENCHMARK_WORKLOADS_H
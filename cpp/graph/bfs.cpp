@@ -16,46 +16,48 @@
  * 
  * Space Complexity: O(V)
  *   for visited array and queue
+ *
+ * Repeated searches:
+ * The overloads taking a BFSWorkspace (bfs_workspace.h) keep the visited
+ * stamps between calls and write into a caller-owned vector, so running
+ * many searches on one graph allocates nothing and never clears O(V) state.
+ *
+ * Shortest paths:
+ * The workspace overloads can also return the level (hop distance) and
+ * BFS parent of every vertex. shortest_path() stops as soon as one of a
+ * set of targets is reached, and bidirectional_shortest_path() searches
+ * from both ends, which explores far fewer vertices on large graphs.
+ *
+ * Graph files:
+ * The CSR overloads also accept a CSRGraphView, so a graph memory-mapped
+ * from a binary graph file (graph_file.h) is searched in place.
+ *
+ * The functions are in bfs.h; this file runs them on examples.
  */
 
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
 #include <iostream>
+#include <random>
 #include <vector>
-#include <queue>
+#include "bfs.h"
+#include "graph_file.h"
 using namespace std;
 
 /**
- * Performs Breadth First Search traversal on a graph
- * 
- * @param start: starting vertex for BFS
- * @param adj: adjacency list of the graph
- * @param vertices: total number of vertices in the graph
- * @return vector containing BFS traversal order
+ * Builds a graph of many small components (paths of component_size
+ * vertices), where each BFS touches only a tiny part of the graph
  */
-vector<int> bfs(int start, const vector<vector<int>>& adj, int vertices) {
-    vector<bool> visited(vertices, false);
-    vector<int> traversal;
-    queue<int> q;
-
-    // Mark the start node as visited and push to queue
-    visited[start] = true;
-    q.push(start);
-
-    while (!q.empty()) {
-        int node = q.front();
-        q.pop();
-
-        traversal.push_back(node);
-
-        // Visit all unvisited neighbors
-        for (int neighbor : adj[node]) {
-            if (!visited[neighbor]) {
-                visited[neighbor] = true;
-                q.push(neighbor);
-            }
+vector<vector<int>> make_small_components(int vertices, int component_size) {
+    vector<vector<int>> adj(vertices);
+    for (int v = 0; v + 1 < vertices; v++) {
+        if ((v + 1) % component_size != 0) {
+            adj[v].push_back(v + 1);
+            adj[v + 1].push_back(v);
         }
     }
-
-    return traversal;
+    return adj;
 }
 
 /**
@@ -63,7 +65,8 @@ vector<int> bfs(int start, const vector<vector<int>>& adj, int vertices) {
  * 
  * @param traversal: vector containing BFS order
  */
-void print_traversal(const vector<int>& traversal) {
+template <typename VertexId>
+void print_traversal(const vector<VertexId>& traversal) {
     cout << "[";
     for (size_t i = 0; i < traversal.size(); i++) {
         cout << traversal[i];
@@ -114,5 +117,171 @@ int main() {
     print_traversal(result4);
     cout << endl;
 
+    // Test Case 5: Same graph in CSR form (32-bit ids), same order as Test 1
+    cout << "Test 5 - CSR graph, BFS starting from node 0:" << endl;
+    CSRGraph<int32_t> csr = CSRGraph<int32_t>::from_adjacency_list(adj);
+    vector<int32_t> result5 = bfs(0, csr);
+    print_traversal(result5);
+    cout << endl;
+
+    // Test Case 6: CSR graph with 64-bit ids built from an edge list
+    cout << "Test 6 - CSR graph (64-bit ids) from edge list, BFS from node 3:" << endl;
+    vector<pair<int64_t, int64_t>> edges = {
+        {0, 1}, {0, 2}, {1, 0}, {1, 3}, {1, 4},
+        {2, 0}, {2, 5}, {3, 1}, {4, 1}, {5, 2}
+    };
+    CSRGraph<int64_t> csr64 = CSRGraph<int64_t>::from_edge_list(6, edges);
+    vector<int64_t> result6 = bfs(int64_t{3}, csr64);
+    print_traversal(result6);
+    cout << endl;
+
+    // Test Case 7: One workspace and output buffer for several searches
+    cout << "Test 7 - Reused workspace, BFS from nodes 0, 3 and 5:" << endl;
+    BFSWorkspace<int> workspace(vertices);
+    vector<int> traversal;
+    for (int start : {0, 3, 5}) {
+        bfs(start, adj, workspace, traversal);
+        print_traversal(traversal);
+    }
+    cout << endl;
+
+    // Test Case 8: Many short searches on a large graph
+    const int kVertices = 1000000;
+    const int kQueries = 20000;
+    vector<vector<int>> big = make_small_components(kVertices, 20);
+    CSRGraph<int> big_csr = CSRGraph<int>::from_adjacency_list(big);
+    mt19937 rng(8);
+    vector<int> sources(kQueries);
+    for (int& s : sources) {
+        s = static_cast<int>(rng() % kVertices);
+    }
+
+    auto t0 = chrono::steady_clock::now();
+    size_t fresh_total = 0;
+    for (int s : sources) {
+        fresh_total += bfs(s, big, kVertices).size();
+    }
+    auto t1 = chrono::steady_clock::now();
+
+    BFSWorkspace<int> big_workspace(kVertices);
+    size_t reused_total = 0;
+    bool all_match = true;
+    for (int s : sources) {
+        bfs(s, big, big_workspace, traversal);
+        reused_total += traversal.size();
+    }
+    auto t2 = chrono::steady_clock::now();
+    // The CSR overload shares the workspace and gives the same order
+    for (int i = 0; i < 100; i++) {
+        bfs(sources[i], big_csr, big_workspace, traversal);
+        all_match = all_match && traversal == bfs(sources[i], big, kVertices);
+    }
+
+    cout << "Test 8 - " << kQueries << " BFS queries on " << kVertices
+         << " vertices (components of 20):" << endl;
+    cout << "Results match: " << (all_match && fresh_total == reused_total ? "yes" : "no") << endl;
+    cout << "  fresh buffers per call: "
+         << chrono::duration<double, milli>(t1 - t0).count() << " ms" << endl;
+    cout << "  reused workspace:       "
+         << chrono::duration<double, milli>(t2 - t1).count() << " ms" << endl;
+    cout << endl;
+
+    // Test Case 9: Levels and parents from node 0
+    cout << "Test 9 - Levels and parents, BFS from node 0:" << endl;
+    vector<int> level;
+    vector<int> parent;
+    bfs(0, adj, workspace, traversal, &level, &parent);
+    cout << "Levels:  ";
+    print_traversal(level);
+    cout << "Parents: ";
+    print_traversal(parent);
+    cout << endl;
+
+    // Test Case 10: Stop at the nearest of several targets
+    cout << "Test 10 - Path from node 3 to the nearest of {5, 4}:" << endl;
+    vector<int> path;
+    BFSWorkspace<int32_t> csr_workspace;
+    int32_t reached = shortest_path(3, vector<int32_t>{5, 4}, csr, csr_workspace, path);
+    cout << "Reached " << reached << " via ";
+    print_traversal(path);
+    cout << endl;
+
+    // Test Case 11: Point-to-point queries on a large directed graph
+    const int kGraphVertices = 500000;
+    const int kPairs = 300;
+    vector<pair<int, int>> edges11;
+    for (int u = 0; u < kGraphVertices; u++) {
+        for (int k = 0; k < 4; k++) {
+            edges11.push_back({u, static_cast<int>(rng() % kGraphVertices)});
+        }
+    }
+    CSRGraph<int> directed = CSRGraph<int>::from_edge_list(kGraphVertices, edges11);
+    CSRGraph<int> incoming = directed.transpose();
+    BFSWorkspace<int> forward(kGraphVertices);
+    BFSWorkspace<int> backward(kGraphVertices);
+
+    vector<pair<int, int>> pairs(kPairs);
+    for (auto& p : pairs) {
+        p = {static_cast<int>(rng() % kGraphVertices), static_cast<int>(rng() % kGraphVertices)};
+    }
+
+    auto t3 = chrono::steady_clock::now();
+    vector<int> one_sided_lengths;
+    for (const auto& p : pairs) {
+        shortest_path(p.first, vector<int>{p.second}, directed, forward, path);
+        one_sided_lengths.push_back(static_cast<int>(path.size()) - 1);
+    }
+    auto t4 = chrono::steady_clock::now();
+    bool paths_valid = true;
+    for (size_t i = 0; i < pairs.size(); i++) {
+        int length = bidirectional_shortest_path(pairs[i].first, pairs[i].second, directed,
+                                                 incoming, forward, backward, path);
+        paths_valid = paths_valid && length == one_sided_lengths[i];
+        for (size_t j = 0; j + 1 < path.size(); j++) {
+            auto out = directed.neighbors(path[j]);
+            paths_valid = paths_valid &&
+                          find(out.begin(), out.end(), path[j + 1]) != out.end();
+        }
+    }
+    auto t5 = chrono::steady_clock::now();
+
+    cout << "Test 11 - " << kPairs << " s-t queries, " << kGraphVertices
+         << " vertices, " << directed.num_edges() << " edges:" << endl;
+    cout << "Paths valid and lengths match: " << (paths_valid ? "yes" : "no") << endl;
+    cout << "  BFS with early exit: "
+         << chrono::duration<double, milli>(t4 - t3).count() << " ms" << endl;
+    cout << "  bidirectional BFS:   "
+         << chrono::duration<double, milli>(t5 - t4).count() << " ms" << endl;
+    cout << endl;
+
+    // Test Case 12: The same graph memory-mapped from a binary graph file
+    string graph_path = (filesystem::temp_directory_path() / "algovault_bfs_graph.bin").string();
+    write_graph_file(graph_path, directed);
+    auto t6 = chrono::steady_clock::now();
+    MappedGraph<int> mapped(graph_path);
+    auto t7 = chrono::steady_clock::now();
+    bool mapped_match = true;
+    for (int i = 0; i < 10; i++) {
+        mapped_match = mapped_match && bfs(pairs[i].first, mapped.graph()) ==
+                                           bfs(pairs[i].first, directed);
+    }
+    cout << "Test 12 - BFS on the memory-mapped graph file:" << endl;
+    cout << "Results match: " << (mapped_match ? "yes" : "no") << endl;
+    cout << "  mapping took " << chrono::duration<double, milli>(t7 - t6).count() << " ms" << endl;
+    filesystem::remove(graph_path);
+    cout << endl;
+
+    // Test Case 13: A new or grown workspace has not visited anything yet
+    BFSWorkspace<int> fresh(4);
+    bool fresh_ok = !fresh.visited(0) && fresh.level(3) == -1;
+    fresh.resize(8);
+    fresh_ok = fresh_ok && !fresh.visited(7) && fresh.level(5) == -1;
+    // Without set_targets() no vertex is a target, so the search runs to the end
+    vector<int> fresh_order;
+    fresh_ok = fresh_ok && !fresh.is_target(0) &&
+               fresh.search(0, [&adj](int v) -> const vector<int>& { return adj[v]; }, fresh_order, true) == -1 &&
+               fresh_order.size() == static_cast<size_t>(vertices);
+    cout << "Test 13 - Fresh workspace state correct: " << (fresh_ok ? "yes" : "no") << endl;
+
     return 0;
 }
@@ -0,0 +1,213 @@
+/*
+ * Breadth First Search (BFS)
+ *
+ * Description:
+ * The BFS functions shown in bfs.cpp, usable from other programs (the
+ * benchmark suite, applications):
+ *   - bfs(start, adj, vertices): textbook BFS over an adjacency list
+ *   - bfs(start, adj / graph, workspace, traversal, level, parent): BFS
+ *     that reuses a BFSWorkspace and can return levels and parents
+ *   - bfs(start, graph): BFS over a CSRGraph or CSRGraphView
+ *   - shortest_path(): BFS that stops at the nearest of a set of targets
+ *   - bidirectional_shortest_path(): s-t shortest path searched from both ends
+ *
+ * Time Complexity: O(V + E)
+ * Space Complexity: O(V)
+ */
+
+#ifndef ALGOVAULT_GRAPH_BFS_H
+#define ALGOVAULT_GRAPH_BFS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <queue>
+#include <vector>
+#include "bfs_workspace.h"
+#include "csr_graph.h"
+#include "../profiling/perf_counters.h"
+
+/**
+ * Performs Breadth First Search traversal on a graph
+ * 
+ * @param start: starting vertex for BFS
+ * @param adj: adjacency list of the graph
+ * @param vertices: total number of vertices in the graph
+ * @return vector containing BFS traversal order
+ */
+inline std::vector<int> bfs(int start, const std::vector<std::vector<int>>& adj, int vertices) {
+    ALGOVAULT_PERF_SCOPE("bfs");
+    std::vector<bool> visited(vertices, false);
+    std::vector<int> traversal;
+    std::queue<int> q;
+
+    // Mark the start node as visited and push to queue
+    visited[start] = true;
+    q.push(start);
+
+    while (!q.empty()) {
+        int node = q.front();
+        q.pop();
+
+        traversal.push_back(node);
+
+        // Visit all unvisited neighbors
+        for (int neighbor : adj[node]) {
+            if (!visited[neighbor]) {
+                visited[neighbor] = true;
+                q.push(neighbor);
+            }
+        }
+    }
+
+    return traversal;
+}
+
+/**
+ * Copies levels and parents of the last search out of a workspace
+ */
+template <typename VertexId>
+void export_levels_and_parents(const BFSWorkspace<VertexId>& workspace, VertexId vertices,
+                               std::vector<VertexId>* level, std::vector<VertexId>* parent) {
+    if (level != nullptr) {
+        level->resize(static_cast<std::size_t>(vertices));
+        for (VertexId v = 0; v < vertices; v++) {
+            (*level)[v] = workspace.level(v);
+        }
+    }
+    if (parent != nullptr) {
+        parent->resize(static_cast<std::size_t>(vertices));
+        for (VertexId v = 0; v < vertices; v++) {
+            (*parent)[v] = workspace.parent(v);
+        }
+    }
+}
+
+/**
+ * Performs Breadth First Search traversal without per-call allocations
+ *
+ * @param start: starting vertex for BFS
+ * @param adj: adjacency list of the graph
+ * @param workspace: visited stamps, reused across calls
+ * @param traversal: receives the BFS traversal order (capacity is reused)
+ * @param level: optional, receives the hop distance of every vertex (-1 = unreached)
+ * @param parent: optional, receives the BFS parent of every vertex (-1 = none)
+ */
+inline void bfs(int start, const std::vector<std::vector<int>>& adj, BFSWorkspace<int>& workspace,
+                std::vector<int>& traversal, std::vector<int>* level = nullptr,
+                std::vector<int>* parent = nullptr) {
+    ALGOVAULT_PERF_SCOPE("bfs_workspace");
+    const int vertices = static_cast<int>(adj.size());
+    workspace.resize(std::max(workspace.num_vertices(), vertices));
+    auto neighbors = [&adj](int node) -> const std::vector<int>& { return adj[node]; };
+    if (level == nullptr && parent == nullptr) {
+        workspace.traverse(start, neighbors, traversal);
+        return;
+    }
+    workspace.search(start, neighbors, traversal);
+    export_levels_and_parents(workspace, vertices, level, parent);
+}
+
+/**
+ * Performs Breadth First Search traversal on a CSR graph, reusing a workspace
+ *
+ * Same traversal as the adjacency list version, but neighbors are read
+ * from one contiguous array. The traversal vector doubles as the queue:
+ * vertices are appended when discovered and consumed through a head index,
+ * so no std::queue (and its deque blocks) is allocated.
+ *
+ * @param start: starting vertex for BFS
+ * @param graph: CSRGraph, or CSRGraphView (e.g. a memory-mapped graph file)
+ * @param workspace: visited stamps, reused across calls
+ * @param traversal: receives the BFS traversal order (capacity is reused)
+ * @param level: optional, receives the hop distance of every vertex (-1 = unreached)
+ * @param parent: optional, receives the BFS parent of every vertex (-1 = none)
+ */
+template <typename Graph>
+void bfs(GraphVertexId<Graph> start, const Graph& graph,
+         BFSWorkspace<GraphVertexId<Graph>>& workspace, std::vector<GraphVertexId<Graph>>& traversal,
+         std::vector<GraphVertexId<Graph>>* level = nullptr,
+         std::vector<GraphVertexId<Graph>>* parent = nullptr) {
+    using VertexId = GraphVertexId<Graph>;
+    ALGOVAULT_PERF_SCOPE("bfs_csr");
+    workspace.resize(std::max(workspace.num_vertices(), graph.num_vertices()));
+    auto neighbors = [&graph](VertexId node) { return graph.neighbors(node); };
+    if (level == nullptr && parent == nullptr) {
+        workspace.traverse(start, neighbors, traversal);
+        return;
+    }
+    workspace.search(start, neighbors, traversal);
+    export_levels_and_parents(workspace, graph.num_vertices(), level, parent);
+}
+
+/**
+ * Shortest path from start to the nearest vertex of a target set
+ *
+ * The search stops as soon as a target is discovered instead of visiting
+ * the whole reachable graph.
+ *
+ * @param start: starting vertex
+ * @param targets: vertices that end the search
+ * @param graph: CSRGraph, or CSRGraphView (e.g. a memory-mapped graph file)
+ * @param workspace: reused search state
+ * @param path: receives start, ..., nearest target (empty if none is reachable)
+ * @return the target reached, -1 if none is reachable
+ */
+template <typename Graph>
+GraphVertexId<Graph> shortest_path(GraphVertexId<Graph> start,
+                                   const std::vector<GraphVertexId<Graph>>& targets, const Graph& graph,
+                                   BFSWorkspace<GraphVertexId<Graph>>& workspace,
+                                   std::vector<GraphVertexId<Graph>>& path) {
+    using VertexId = GraphVertexId<Graph>;
+    workspace.resize(std::max(workspace.num_vertices(), graph.num_vertices()));
+    workspace.set_targets(targets);
+    VertexId reached = workspace.search(
+        start, [&graph](VertexId node) { return graph.neighbors(node); }, workspace.queue(), true);
+    path.clear();
+    if (reached >= 0) {
+        workspace.path_to(reached, path);
+    }
+    return reached;
+}
+
+/**
+ * Shortest path from source to target using bidirectional BFS
+ *
+ * @param source, target: endpoints
+ * @param graph: directed graph
+ * @param incoming: graph.transpose() (pass graph itself if undirected)
+ * @param forward, backward: reused search state for the two directions
+ * @param path: receives source, ..., target (empty if unreachable)
+ * @return number of edges on the path, -1 if unreachable
+ */
+template <typename Graph>
+GraphVertexId<Graph> bidirectional_shortest_path(GraphVertexId<Graph> source,
+                                                 GraphVertexId<Graph> target, const Graph& graph,
+                                                 const Graph& incoming,
+                                                 BFSWorkspace<GraphVertexId<Graph>>& forward,
+                                                 BFSWorkspace<GraphVertexId<Graph>>& backward,
+                                                 std::vector<GraphVertexId<Graph>>& path) {
+    using VertexId = GraphVertexId<Graph>;
+    forward.resize(std::max(forward.num_vertices(), graph.num_vertices()));
+    backward.resize(std::max(backward.num_vertices(), graph.num_vertices()));
+    return bidirectional_bfs(
+        source, target, [&graph](VertexId node) { return graph.neighbors(node); },
+        [&incoming](VertexId node) { return incoming.neighbors(node); }, forward, backward, path);
+}
+
+/**
+ * Performs Breadth First Search traversal on a CSR graph
+ *
+ * @param start: starting vertex for BFS
+ * @param graph: CSRGraph, or CSRGraphView (e.g. a memory-mapped graph file)
+ * @return vector containing BFS traversal order
+ */
+template <typename Graph>
+std::vector<GraphVertexId<Graph>> bfs(GraphVertexId<Graph> start, const Graph& graph) {
+    using VertexId = GraphVertexId<Graph>;
+    BFSWorkspace<VertexId> workspace(graph.num_vertices());
+    std::vector<VertexId> traversal;
+    bfs(start, graph, workspace, traversal);
+    return traversal;
+}
+
+#endif // ALGOVAULT_GRAPH_BFS_H
@@ -0,0 +1,320 @@
+/*
+ * Reusable BFS Workspace
+ *
+ * Description:
+ * A plain BFS allocates a visited array of V entries, a queue and a result
+ * vector on every call, and clearing the visited array alone costs O(V).
+ * When many short searches run on the same large graph, that setup costs
+ * more than the searches themselves.
+ *
+ * BFSWorkspace keeps its buffers between calls. Instead of a visited flag
+ * each vertex stores the epoch (search number) in which it was last
+ * visited, so starting a new search is one increment: every stamp from an
+ * older epoch means "not visited". Only when the 32-bit epoch wraps around
+ * (every 4 billion searches) is the stamp array cleared.
+ *
+ * The traversal is written to a caller-owned vector that doubles as the
+ * queue; once its capacity has grown, repeated searches allocate nothing.
+ *
+ * search() also records the BFS level and parent of every visited vertex
+ * (valid until the next search) and can stop as soon as a target is
+ * discovered. bidirectional_bfs() answers s-t queries with two workspaces,
+ * growing a search from each end until they meet.
+ *
+ * Usage:
+ *     BFSWorkspace<int> workspace(graph.num_vertices());
+ *     vector<int> order;
+ *     for (int source : sources) {
+ *         workspace.traverse(source, [&](int v) { return graph.neighbors(v); }, order);
+ *         ...
+ *     }
+ *
+ * Time Complexity: O(visited vertices + their edges) per search
+ * Space Complexity: O(V) stamps, kept between searches
+ */
+
+#ifndef ALGOVAULT_GRAPH_BFS_WORKSPACE_H
+#define ALGOVAULT_GRAPH_BFS_WORKSPACE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+template <typename VertexId = std::int32_t>
+class BFSWorkspace {
+public:
+    /**
+     * @param num_vertices: number of vertices of the graphs searched
+     */
+    explicit BFSWorkspace(VertexId num_vertices = 0) { resize(num_vertices); }
+
+    /**
+     * @return number of vertices the workspace has room for
+     */
+    VertexId num_vertices() const { return static_cast<VertexId>(stamp_.size()); }
+
+    /**
+     * Makes room for num_vertices vertices (new vertices are unvisited)
+     */
+    void resize(VertexId num_vertices) {
+        const std::size_t n = static_cast<std::size_t>(num_vertices);
+        stamp_.resize(n, 0);
+        target_stamp_.resize(n, 0);
+        level_.resize(n);
+        parent_.resize(n);
+    }
+
+    /**
+     * Starts a new search: every vertex becomes unvisited, in O(1)
+     */
+    void reset() {
+        if (++epoch_ == 0) {
+            std::fill(stamp_.begin(), stamp_.end(), 0);
+            epoch_ = 1;
+        }
+    }
+
+    /**
+     * @return true if v was visited since the last reset()
+     */
+    bool visited(VertexId v) const { return stamp_[static_cast<std::size_t>(v)] == epoch_; }
+
+    /**
+     * Marks v as visited
+     * @return true if v was not visited before
+     */
+    bool visit(VertexId v) {
+        std::uint32_t& stamp = stamp_[static_cast<std::size_t>(v)];
+        if (stamp == epoch_) {
+            return false;
+        }
+        stamp = epoch_;
+        return true;
+    }
+
+    /**
+     * Marks v as visited and records how it was reached
+     * @return true if v was not visited before
+     */
+    bool visit(VertexId v, VertexId parent, VertexId level) {
+        if (!visit(v)) {
+            return false;
+        }
+        level_[static_cast<std::size_t>(v)] = level;
+        parent_[static_cast<std::size_t>(v)] = parent;
+        return true;
+    }
+
+    /**
+     * @return BFS level of v in the last search(), -1 if not visited
+     */
+    VertexId level(VertexId v) const { return visited(v) ? level_[static_cast<std::size_t>(v)] : -1; }
+
+    /**
+     * @return BFS parent of v in the last search(), -1 for the start vertex
+     *         and for vertices that were not visited
+     */
+    VertexId parent(VertexId v) const { return visited(v) ? parent_[static_cast<std::size_t>(v)] : -1; }
+
+    /**
+     * Replaces the target set used by search() (O(count))
+     */
+    void set_targets(const std::vector<VertexId>& targets) {
+        if (++target_epoch_ == 0) {
+            std::fill(target_stamp_.begin(), target_stamp_.end(), 0);
+            target_epoch_ = 1;
+        }
+        for (VertexId t : targets) {
+            target_stamp_[static_cast<std::size_t>(t)] = target_epoch_;
+        }
+    }
+
+    /**
+     * @return true if v is in the current target set
+     */
+    bool is_target(VertexId v) const {
+        return target_stamp_[static_cast<std::size_t>(v)] == target_epoch_;
+    }
+
+    /**
+     * @return scratch queue kept for searches that do not hand out their
+     *         visit order (bidirectional_bfs)
+     */
+    std::vector<VertexId>& queue() { return queue_; }
+
+    /**
+     * Path from the start of the last search() to v, following parents
+     * @param path: receives start, ..., v (empty if v was not visited)
+     */
+    void path_to(VertexId v, std::vector<VertexId>& path) const {
+        path.clear();
+        if (!visited(v)) {
+            return;
+        }
+        for (; v >= 0; v = parent_[static_cast<std::size_t>(v)]) {
+            path.push_back(v);
+        }
+        std::reverse(path.begin(), path.end());
+    }
+
+    /**
+     * Breadth first search from start, reusing the workspace buffers
+     *
+     * @param start: starting vertex
+     * @param neighbors: callable, neighbors(v) returns the out-neighbors of
+     *                   v (return a reference or a view, not a copy)
+     * @param order: receives the BFS order; its capacity is reused
+     */
+    template <typename NeighborFn>
+    void traverse(VertexId start, NeighborFn&& neighbors, std::vector<VertexId>& order) {
+        reset();
+        order.clear();
+        visit(start);
+        order.push_back(start);
+
+        for (std::size_t head = 0; head < order.size(); head++) {
+            for (VertexId neighbor : neighbors(order[head])) {
+                if (visit(neighbor)) {
+                    order.push_back(neighbor);
+                }
+            }
+        }
+    }
+
+    /**
+     * Breadth first search that records levels and parents
+     *
+     * @param start: starting vertex
+     * @param neighbors: callable, neighbors(v) returns the out-neighbors of v
+     * @param order: receives the visited vertices in BFS order
+     * @param stop_at_target: stop as soon as a vertex of the target set
+     *                        (set_targets) is discovered
+     * @return the target reached, or -1 (always -1 without stop_at_target)
+     */
+    template <typename NeighborFn>
+    VertexId search(VertexId start, NeighborFn&& neighbors, std::vector<VertexId>& order,
+                    bool stop_at_target = false) {
+        reset();
+        order.clear();
+        visit(start, -1, 0);
+        order.push_back(start);
+        if (stop_at_target && is_target(start)) {
+            return start;
+        }
+
+        for (std::size_t head = 0; head < order.size(); head++) {
+            const VertexId node = order[head];
+            const VertexId next_level = level_[static_cast<std::size_t>(node)] + 1;
+            for (VertexId neighbor : neighbors(node)) {
+                if (visit(neighbor, node, next_level)) {
+                    order.push_back(neighbor);
+                    // The level at discovery is final, so stopping is exact
+                    if (stop_at_target && is_target(neighbor)) {
+                        return neighbor;
+                    }
+                }
+            }
+        }
+        return -1;
+    }
+
+private:
+    std::vector<std::uint32_t> stamp_;  // epoch of the last visit
+    std::uint32_t epoch_ = 1;  // stamp 0 always means "not visited"
+    std::vector<std::uint32_t> target_stamp_;
+    std::uint32_t target_epoch_ = 1;  // stamp 0 always means "not a target"
+    std::vector<VertexId> level_;   // valid where stamp_ == epoch_
+    std::vector<VertexId> parent_;  // valid where stamp_ == epoch_
+    std::vector<VertexId> queue_;
+};
+
+/**
+ * Expands every vertex of one BFS level of one side of a bidirectional
+ * search and looks for vertices already reached by the other side
+ * @return best meeting vertex of this level, or -1
+ */
+template <typename VertexId, typename NeighborFn>
+VertexId bidirectional_bfs_level(NeighborFn& neighbors, BFSWorkspace<VertexId>& side,
+                                 const BFSWorkspace<VertexId>& other,
+                                 std::vector<VertexId>& queue, std::size_t& head) {
+    VertexId meet = -1;
+    VertexId best = -1;
+    const std::size_t level_end = queue.size();
+    for (; head < level_end; head++) {
+        const VertexId node = queue[head];
+        const VertexId next_level = side.level(node) + 1;
+        for (VertexId neighbor : neighbors(node)) {
+            if (side.visit(neighbor, node, next_level)) {
+                queue.push_back(neighbor);
+                if (other.visited(neighbor)) {
+                    const VertexId length = next_level + other.level(neighbor);
+                    if (best < 0 || length < best) {
+                        best = length;
+                        meet = neighbor;
+                    }
+                }
+            }
+        }
+    }
+    return meet;
+}
+
+/**
+ * Shortest path from source to target, searching from both ends
+ *
+ * Each step expands one full level of the side with the smaller frontier.
+ * Once a level finds vertices seen by the other side, the shortest path
+ * goes through the best of them, so the search stops there.
+ *
+ * @param source, target: endpoints of the query
+ * @param out_neighbors: callable, out-neighbors of a vertex
+ * @param in_neighbors: callable, in-neighbors (same as out for undirected graphs)
+ * @param forward, backward: workspaces for the two searches
+ * @param path: receives source, ..., target (empty if unreachable)
+ * @return number of edges on the path, -1 if target is unreachable
+ */
+template <typename VertexId, typename OutNeighborFn, typename InNeighborFn>
+VertexId bidirectional_bfs(VertexId source, VertexId target, OutNeighborFn&& out_neighbors,
+                           InNeighborFn&& in_neighbors, BFSWorkspace<VertexId>& forward,
+                           BFSWorkspace<VertexId>& backward, std::vector<VertexId>& path) {
+    path.clear();
+    forward.reset();
+    backward.reset();
+    forward.visit(source, -1, 0);
+    backward.visit(target, -1, 0);
+    if (source == target) {
+        path.push_back(source);
+        return 0;
+    }
+
+    std::vector<VertexId>& forward_queue = forward.queue();
+    std::vector<VertexId>& backward_queue = backward.queue();
+    forward_queue.assign(1, source);
+    backward_queue.assign(1, target);
+    std::size_t forward_head = 0;
+    std::size_t backward_head = 0;
+    VertexId meet = -1;
+
+    while (meet < 0 && forward_head < forward_queue.size() &&
+           backward_head < backward_queue.size()) {
+        if (forward_queue.size() - forward_head <= backward_queue.size() - backward_head) {
+            meet = bidirectional_bfs_level(out_neighbors, forward, backward, forward_queue,
+                                           forward_head);
+        } else {
+            meet = bidirectional_bfs_level(in_neighbors, backward, forward, backward_queue,
+                                           backward_head);
+        }
+    }
+    if (meet < 0) {
+        return -1;
+    }
+
+    forward.path_to(meet, path);
+    for (VertexId v = backward.parent(meet); v >= 0; v = backward.parent(v)) {
+        path.push_back(v);
+    }
+    return static_cast<VertexId>(path.size() - 1);
+}
+
+#endif // ALGOVAULT_GRAPH_BFS_WORKSPACE_H
@@ -0,0 +1,158 @@
+/*
+ * Connected Components Examples
+ *
+ * Description:
+ * Labels the connected components of undirected graphs with
+ * connected_components.h: one BFS per component, or parallel lock-free
+ * union-find (Afforest) on a thread pool. Both number components in the
+ * order of their smallest vertex, so their results can be compared.
+ *
+ * Time Complexity: O(V + E)
+ * Space Complexity: O(V)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+#include "connected_components.h"
+using namespace std;
+
+/**
+ * Builds a random undirected graph with about vertices * degree / 2 edges;
+ * with degree < 2 it falls apart into many components
+ */
+CSRGraph<int> make_random_graph(int vertices, double degree, unsigned seed) {
+    mt19937 rng(seed);
+    uniform_int_distribution<int> pick(0, vertices - 1);
+    vector<pair<int, int>> edges;
+    const long long num_edges = static_cast<long long>(vertices * degree / 2);
+    for (long long e = 0; e < num_edges; e++) {
+        int u = pick(rng);
+        int v = pick(rng);
+        edges.push_back({u, v});
+        edges.push_back({v, u});
+    }
+    return CSRGraph<int>::from_edge_list(vertices, edges);
+}
+
+/**
+ * Builds one long path that visits the vertices in random order, so
+ * union-find trees get deep and cross many kComponentsGrain chunks
+ */
+CSRGraph<int> make_random_path(int vertices, unsigned seed) {
+    mt19937 rng(seed);
+    vector<int> order(static_cast<size_t>(vertices));
+    for (int i = 0; i < vertices; i++) {
+        order[i] = i;
+    }
+    shuffle(order.begin(), order.end(), rng);
+    vector<pair<int, int>> edges;
+    for (int i = 0; i + 1 < vertices; i++) {
+        edges.push_back({order[i], order[i + 1]});
+        edges.push_back({order[i + 1], order[i]});
+    }
+    return CSRGraph<int>::from_edge_list(vertices, edges);
+}
+
+/**
+ * Prints a vector
+ * @param arr: vector to print
+ */
+void print_vector(const vector<int>& arr) {
+    cout << "[";
+    for (size_t i = 0; i < arr.size(); i++) {
+        cout << arr[i];
+        if (i < arr.size() - 1) {
+            cout << ", ";
+        }
+    }
+    cout << "]" << endl;
+}
+
+// Example usage and test cases
+int main() {
+    cout << "=== Connected Components Examples ===" << endl << endl;
+
+    ThreadPool pool(4);
+
+    // Test Case 1: Three components
+    vector<vector<int>> adj(8);
+    adj[0] = {1, 2};
+    adj[1] = {0};
+    adj[2] = {0};
+    adj[3] = {4};
+    adj[4] = {3, 6};
+    adj[6] = {4};
+    adj[5] = {7};
+    adj[7] = {5};
+    Components<int> bfs1 = connected_components_bfs(adj);
+    Components<int> uf1 = connected_components_union_find(adj, pool);
+    cout << "Test 1 - Small graph:" << endl;
+    cout << "Components (BFS):        ";
+    print_vector(bfs1.component);
+    cout << "Components (union-find): ";
+    print_vector(uf1.component);
+    cout << "Sizes: ";
+    print_vector(bfs1.size);
+    cout << endl;
+
+    // Test Case 2: Empty graph
+    Components<int> empty = connected_components_bfs(vector<vector<int>>{});
+    cout << "Test 2 - Empty graph: " << empty.count() << " components" << endl << endl;
+
+    // Test Case 3: Random graphs around the giant component threshold
+    cout << "Test 3 - Random graphs (200000 vertices), BFS vs union-find:" << endl;
+    bool all_match = true;
+    for (double degree : {0.5, 1.0, 1.5, 4.0}) {
+        CSRGraph<int> graph = make_random_graph(200000, degree, 7);
+        Components<int> bfs = connected_components_bfs(graph);
+        Components<int> uf = connected_components_union_find(graph, pool);
+        all_match = all_match && bfs.component == uf.component && bfs.size == uf.size;
+        cout << "  average degree " << degree << ": " << bfs.count()
+             << " components, largest " << *max_element(bfs.size.begin(), bfs.size.end())
+             << " vertices" << endl;
+    }
+    cout << "Labels match: " << (all_match ? "yes" : "no") << endl << endl;
+
+    // Test Case 4: Compression points every vertex at its root, even when a
+    // vertex deep in the tree is compressed before the vertices above it
+    // (what happens when a later chunk runs before an earlier one)
+    const int kChain = 1000;
+    ConcurrentForest<int> chain(kChain);
+    for (int v = 0; v < kChain; v++) {
+        chain.parent(v).store(v > 0 ? v - 1 : 0);
+    }
+    bool roots_ok = true;
+    for (int v = kChain - 1; v >= 0; v -= 7) {
+        roots_ok = roots_ok && chain.compress(v) == 0 && chain.parent(v).load() == 0;
+    }
+    ThreadPool wide_pool(8);
+    for (unsigned seed : {1u, 2u, 3u}) {
+        CSRGraph<int> path = make_random_path(5 * static_cast<int>(kComponentsGrain), seed);
+        Components<int> bfs = connected_components_bfs(path);
+        Components<int> uf = connected_components_union_find(path, wide_pool);
+        roots_ok = roots_ok && bfs.component == uf.component && bfs.size == uf.size;
+    }
+    cout << "Test 4 - Deep trees across chunks, " << wide_pool.size() << " threads:" << endl;
+    cout << "Labels match: " << (roots_ok ? "yes" : "no") << endl << endl;
+
+    // Test Case 5: Timing on a larger graph
+    const int kVertices = 2000000;
+    CSRGraph<int> big = make_random_graph(kVertices, 8.0, 9);
+    auto t0 = chrono::steady_clock::now();
+    Components<int> big_bfs = connected_components_bfs(big);
+    auto t1 = chrono::steady_clock::now();
+    Components<int> big_uf = connected_components_union_find(big, pool);
+    auto t2 = chrono::steady_clock::now();
+    cout << "Test 5 - " << kVertices << " vertices, " << big.num_edges() << " edges:" << endl;
+    cout << "Labels match: " << (big_bfs.component == big_uf.component ? "yes" : "no") << endl;
+    cout << "  BFS labeling:          " << chrono::duration<double, milli>(t1 - t0).count()
+         << " ms" << endl;
+    cout << "  union-find, " << pool.size() << " threads: "
+         << chrono::duration<double, milli>(t2 - t1).count() << " ms" << endl;
+
+    return 0;
+}
@@ -0,0 +1,286 @@
+/*
+ * Connected Components of undirected graphs
+ *
+ * Description:
+ * Two ways to label every vertex with the id of its connected component:
+ *
+ *   1. BFS labeling: a BFS (BFSWorkspace) from every vertex that is not
+ *      labeled yet; its traversal is exactly one component. O(V + E),
+ *      single-threaded.
+ *   2. Parallel union-find (Afforest): every vertex starts as its own tree.
+ *      Threads link the endpoints of edges with lock-free compare-and-swap
+ *      "hooks" that always point the larger root to the smaller one, and
+ *      path compression flattens the trees.
+ *        a. Link only the first kAfforestSampleRounds neighbors of every
+ *           vertex and compress. On real graphs this already connects most
+ *           of the giant component.
+ *        b. Find the most common root by sampling vertices.
+ *        c. Link the remaining edges, skipping every vertex that is already
+ *           in that component (most of the graph on real inputs).
+ *        d. Compress so that every vertex points directly at its root.
+ *
+ * Both return the same labels: components are numbered 0, 1, ... in the
+ * order of their smallest vertex. The graph must be undirected (every edge
+ * stored in both directions).
+ *
+ * Time Complexity: O(V + E) for BFS labeling,
+ *   O((V + E) * alpha(V) / p) expected for union-find with p threads
+ * Space Complexity: O(V)
+ */
+
+#ifndef ALGOVAULT_GRAPH_CONNECTED_COMPONENTS_H
+#define ALGOVAULT_GRAPH_CONNECTED_COMPONENTS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include "../parallel/thread_pool.h"
+#include "bfs_workspace.h"
+#include "csr_graph.h"
+
+// Neighbors per vertex linked before looking for the largest component
+const std::size_t kAfforestSampleRounds = 2;
+
+// Vertices sampled to find the largest intermediate component
+const std::size_t kAfforestSampleSize = 1024;
+
+// Vertices handled by one thread at a time
+const std::size_t kComponentsGrain = 1 << 14;
+
+/**
+ * Component labeling of a graph
+ * - component: component id of every vertex (0 .. count - 1)
+ * - size: number of vertices of every component
+ */
+template <typename VertexId>
+struct Components {
+    std::vector<VertexId> component;
+    std::vector<VertexId> size;
+
+    VertexId count() const { return static_cast<VertexId>(size.size()); }
+};
+
+/**
+ * Labels components with one BFS per component
+ *
+ * @param num_vertices: number of vertices
+ * @param neighbors: callable, neighbors(v) returns the neighbors of v
+ * @return component id of every vertex and size of every component
+ */
+template <typename VertexId, typename NeighborFn>
+Components<VertexId> connected_components_bfs(VertexId num_vertices, NeighborFn neighbors) {
+    Components<VertexId> result;
+    result.component.assign(static_cast<std::size_t>(num_vertices), -1);
+    BFSWorkspace<VertexId> workspace(num_vertices);
+    std::vector<VertexId> order;
+
+    for (VertexId v = 0; v < num_vertices; v++) {
+        if (result.component[v] >= 0) {
+            continue;
+        }
+        workspace.traverse(v, neighbors, order);
+        const VertexId id = result.count();
+        for (VertexId u : order) {
+            result.component[u] = id;
+        }
+        result.size.push_back(static_cast<VertexId>(order.size()));
+    }
+    return result;
+}
+
+/**
+ * Lock-free union-find forest used by the parallel labeling
+ */
+template <typename VertexId>
+class ConcurrentForest {
+public:
+    explicit ConcurrentForest(std::size_t n) : parent_(n) {}
+
+    std::atomic<VertexId>& parent(VertexId v) { return parent_[static_cast<std::size_t>(v)]; }
+
+    /**
+     * Joins the trees of u and v: the larger root is hooked below the
+     * smaller one with a CAS, retrying when another thread got there first
+     */
+    void link(VertexId u, VertexId v) {
+        VertexId p1 = parent(u).load(std::memory_order_relaxed);
+        VertexId p2 = parent(v).load(std::memory_order_relaxed);
+        while (p1 != p2) {
+            const VertexId high = std::max(p1, p2);
+            const VertexId low = std::min(p1, p2);
+            VertexId high_parent = parent(high).load(std::memory_order_relaxed);
+            // high is already below low, or high is a root we can hook
+            if (high_parent == low ||
+                (high_parent == high &&
+                 parent(high).compare_exchange_strong(high_parent, low, std::memory_order_relaxed))) {
+                return;
+            }
+            p1 = parent(parent(high).load(std::memory_order_relaxed)).load(std::memory_order_relaxed);
+            p2 = parent(low).load(std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Points v directly at its root: v's own parent moves up to its
+     * grandparent until it is the root. Stepping v along the path instead
+     * would leave v below a non-root when the vertices above it have not
+     * been compressed yet (another chunk, another thread).
+     * @return the root of v
+     */
+    VertexId compress(VertexId v) {
+        VertexId p = parent(v).load(std::memory_order_relaxed);
+        VertexId grandparent = parent(p).load(std::memory_order_relaxed);
+        while (p != grandparent) {
+            parent(v).store(grandparent, std::memory_order_relaxed);
+            p = grandparent;
+            grandparent = parent(p).load(std::memory_order_relaxed);
+        }
+        return p;
+    }
+
+private:
+    std::vector<std::atomic<VertexId>> parent_;
+};
+
+/**
+ * Labels components with parallel union-find (Afforest)
+ *
+ * @param num_vertices: number of vertices
+ * @param neighbors: callable, neighbors(v) returns the neighbors of v as a
+ *                   range with size() and operator[]
+ * @param pool: threads used for linking and compression
+ * @return component id of every vertex and size of every component
+ */
+template <typename VertexId, typename NeighborFn>
+Components<VertexId> connected_components_union_find(VertexId num_vertices, NeighborFn neighbors,
+                                                     ThreadPool& pool) {
+    const std::size_t n = static_cast<std::size_t>(num_vertices);
+    ConcurrentForest<VertexId> forest(n);
+    auto compress_all = [&] {
+        pool.parallel_for(0, n, kComponentsGrain, [&](unsigned, std::size_t lo, std::size_t hi) {
+            for (std::size_t v = lo; v < hi; v++) {
+                forest.compress(static_cast<VertexId>(v));
+            }
+        });
+    };
+
+    pool.parallel_for(0, n, kComponentsGrain, [&](unsigned, std::size_t lo, std::size_t hi) {
+        for (std::size_t v = lo; v < hi; v++) {
+            forest.parent(static_cast<VertexId>(v)).store(static_cast<VertexId>(v),
+                                                          std::memory_order_relaxed);
+        }
+    });
+
+    // a. Link a few neighbors of every vertex
+    for (std::size_t round = 0; round < kAfforestSampleRounds; round++) {
+        pool.parallel_for(0, n, kComponentsGrain, [&](unsigned, std::size_t lo, std::size_t hi) {
+            for (std::size_t v = lo; v < hi; v++) {
+                const auto& out = neighbors(static_cast<VertexId>(v));
+                if (round < static_cast<std::size_t>(out.size())) {
+                    forest.link(static_cast<VertexId>(v), out[round]);
+                }
+            }
+        });
+        compress_all();
+    }
+
+    // b. Most common root among sampled vertices
+    VertexId largest = -1;
+    if (n > 0) {
+        std::unordered_map<VertexId, std::size_t> frequency;
+        std::mt19937 rng(static_cast<unsigned>(n));
+        std::size_t best = 0;
+        for (std::size_t i = 0; i < kAfforestSampleSize; i++) {
+            VertexId root = forest.parent(static_cast<VertexId>(rng() % n)).load(std::memory_order_relaxed);
+            if (++frequency[root] > best) {
+                best = frequency[root];
+                largest = root;
+            }
+        }
+    }
+
+    // c. Remaining edges, skipping the largest component
+    pool.parallel_for(0, n, kComponentsGrain, [&](unsigned, std::size_t lo, std::size_t hi) {
+        for (std::size_t v = lo; v < hi; v++) {
+            if (forest.parent(static_cast<VertexId>(v)).load(std::memory_order_relaxed) == largest) {
+                continue;
+            }
+            const auto& out = neighbors(static_cast<VertexId>(v));
+            for (std::size_t i = kAfforestSampleRounds; i < static_cast<std::size_t>(out.size()); i++) {
+                forest.link(static_cast<VertexId>(v), out[i]);
+            }
+        }
+    });
+
+    // d. Every vertex points at its root, the smallest vertex of its component
+    compress_all();
+
+    // Number components in order of their smallest vertex, like BFS labeling
+    Components<VertexId> result;
+    std::vector<VertexId> id_of_root(n, -1);
+    for (std::size_t v = 0; v < n; v++) {
+        if (forest.parent(static_cast<VertexId>(v)).load(std::memory_order_relaxed) ==
+            static_cast<VertexId>(v)) {
+            id_of_root[v] = result.count();
+            result.size.push_back(0);
+        }
+    }
+    result.component.resize(n);
+    pool.parallel_for(0, n, kComponentsGrain, [&](unsigned, std::size_t lo, std::size_t hi) {
+        for (std::size_t v = lo; v < hi; v++) {
+            result.component[v] =
+                id_of_root[forest.parent(static_cast<VertexId>(v)).load(std::memory_order_relaxed)];
+        }
+    });
+    for (VertexId id : result.component) {
+        result.size[id]++;
+    }
+    return result;
+}
+
+/**
+ * Connected components of an undirected CSR graph with BFS labeling
+ */
+template <typename VertexId>
+Components<VertexId> connected_components_bfs(const CSRGraph<VertexId>& graph) {
+    return connected_components_bfs(graph.num_vertices(),
+                                    [&graph](VertexId v) { return graph.neighbors(v); });
+}
+
+/**
+ * Connected components of an undirected CSR graph with parallel union-find
+ */
+template <typename VertexId>
+Components<VertexId> connected_components_union_find(const CSRGraph<VertexId>& graph,
+                                                     ThreadPool& pool) {
+    return connected_components_union_find(graph.num_vertices(),
+                                           [&graph](VertexId v) { return graph.neighbors(v); },
+                                           pool);
+}
+
+/**
+ * Connected components of an undirected adjacency list with BFS labeling
+ * @param adj: adjacency list (every edge in both directions)
+ */
+inline Components<int> connected_components_bfs(const std::vector<std::vector<int>>& adj) {
+    return connected_components_bfs(static_cast<int>(adj.size()),
+                                    [&adj](int v) -> const std::vector<int>& { return adj[v]; });
+}
+
+/**
+ * Connected components of an undirected adjacency list with union-find
+ * @param adj: adjacency list (every edge in both directions)
+ * @param pool: threads to use
+ */
+inline Components<int> connected_components_union_find(const std::vector<std::vector<int>>& adj,
+                                                       ThreadPool& pool) {
+    return connected_components_union_find(static_cast<int>(adj.size()),
+                                           [&adj](int v) -> const std::vector<int>& { return adj[v]; },
+                                           pool);
+}
+
+#endif // ALGOVAULT_GRAPH_CONNECTED_COMPONENTS_H
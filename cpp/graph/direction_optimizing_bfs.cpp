@@ -0,0 +1,164 @@
+/*
+ * Direction-Optimizing BFS Examples
+ *
+ * Description:
+ * direction_optimizing_bfs() (see direction_optimizing_bfs.h) runs the big
+ * middle levels of a BFS bottom-up: every unvisited vertex looks for a
+ * parent in the frontier bitmap, which on low-diameter graphs checks far
+ * fewer edges than pushing from the frontier. Levels are the same as a
+ * top-down BFS.
+ *
+ * Time Complexity: O(V + E) worst case, usually far fewer edge checks
+ * Space Complexity: O(V)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "bfs.h"
+#include "csr_graph.h"
+#include "direction_optimizing_bfs.h"
+using namespace std;
+
+/**
+ * Reference top-down BFS levels used to check the results
+ */
+vector<int> top_down_levels(int start, const CSRGraph<int>& graph) {
+    vector<int> level(static_cast<size_t>(graph.num_vertices()), -1);
+    vector<int> queue = {start};
+    level[start] = 0;
+    for (size_t head = 0; head < queue.size(); head++) {
+        int node = queue[head];
+        for (int neighbor : graph.neighbors(node)) {
+            if (level[neighbor] == -1) {
+                level[neighbor] = level[node] + 1;
+                queue.push_back(neighbor);
+            }
+        }
+    }
+    return level;
+}
+
+/**
+ * Builds a random undirected graph with a skewed degree distribution
+ * (a few hubs, many low degree vertices), similar to social networks
+ */
+CSRGraph<int> make_social_graph(int vertices, int edges_per_vertex, unsigned seed) {
+    mt19937 rng(seed);
+    uniform_real_distribution<double> unit(0.0, 1.0);
+    vector<pair<int, int>> edges;
+    edges.reserve(static_cast<size_t>(vertices) * edges_per_vertex * 2);
+    for (int u = 0; u < vertices; u++) {
+        for (int k = 0; k < edges_per_vertex; k++) {
+            // Squaring a uniform number biases targets towards low ids (hubs)
+            double r = unit(rng);
+            int v = static_cast<int>(r * r * vertices);
+            if (v != u) {
+                edges.push_back({u, v});
+                edges.push_back({v, u});
+            }
+        }
+    }
+    return CSRGraph<int>::from_edge_list(vertices, edges);
+}
+
+/**
+ * Prints a vector
+ * @param arr: vector to print
+ */
+void print_vector(const vector<int>& arr) {
+    cout << "[";
+    for (size_t i = 0; i < arr.size(); i++) {
+        cout << arr[i];
+        if (i < arr.size() - 1) {
+            cout << ", ";
+        }
+    }
+    cout << "]" << endl;
+}
+
+// Example usage and test cases
+int main() {
+    cout << "=== Direction-Optimizing BFS Examples ===" << endl << endl;
+
+    // Same undirected graph as in bfs.cpp
+    int vertices = 6;
+    vector<vector<int>> adj(vertices);
+    adj[0] = {1, 2};
+    adj[1] = {0, 3, 4};
+    adj[2] = {0, 5};
+    adj[3] = {1};
+    adj[4] = {1};
+    adj[5] = {2};
+
+    // Test Case 1: Adjacency list entry point
+    cout << "Test 1 - BFS starting from node 0:" << endl;
+    print_vector(direction_optimizing_bfs(0, adj, vertices));
+    cout << endl;
+
+    // Test Case 2: Levels, forcing bottom-up as early as possible
+    cout << "Test 2 - Levels from node 1 (aggressive bottom-up):" << endl;
+    CSRGraph<int> small = CSRGraph<int>::from_adjacency_list(adj);
+    DirectionOptimizingOptions eager;
+    eager.alpha = 1e9;
+    eager.beta = 1e9;
+    BFSResult<int> result2 = direction_optimizing_bfs(1, small, eager);
+    cout << "Traversal: ";
+    print_vector(result2.traversal);
+    cout << "Levels:    ";
+    print_vector(result2.level);
+    cout << "Bottom-up steps: " << result2.bottom_up_steps << endl << endl;
+
+    // Test Case 3: Directed graph needs the transpose for bottom-up steps
+    cout << "Test 3 - Directed graph, unreachable vertex 4:" << endl;
+    vector<pair<int, int>> directed_edges = {{0, 1}, {0, 2}, {1, 3}, {2, 3}, {4, 0}};
+    CSRGraph<int> directed = CSRGraph<int>::from_edge_list(5, directed_edges);
+    BFSResult<int> result3 = direction_optimizing_bfs(0, directed, directed.transpose(), eager);
+    cout << "Levels: ";
+    print_vector(result3.level);
+    cout << endl;
+
+    // Test Case 4: Larger social-style graph, compared with top-down BFS
+    cout << "Test 4 - Social-style graph (100000 vertices):" << endl;
+    CSRGraph<int> social = make_social_graph(100000, 8, 42);
+    cout << "Edges: " << social.num_edges() << endl;
+
+    auto t0 = chrono::steady_clock::now();
+    vector<int> expected = top_down_levels(0, social);
+    auto t1 = chrono::steady_clock::now();
+    BFSResult<int> result4 = direction_optimizing_bfs(0, social);
+    auto t2 = chrono::steady_clock::now();
+
+    cout << "Levels match top-down BFS: " << (result4.level == expected ? "yes" : "no") << endl;
+    cout << "Reached vertices: " << result4.traversal.size() << endl;
+    cout << "Top-down steps: " << result4.top_down_steps
+         << ", bottom-up steps: " << result4.bottom_up_steps << endl;
+    cout << "Top-down time: "
+         << chrono::duration<double, milli>(t1 - t0).count() << " ms" << endl;
+    cout << "Direction-optimizing time: "
+         << chrono::duration<double, milli>(t2 - t1).count() << " ms" << endl << endl;
+
+    // Test Case 5: A CSRGraphView (e.g. a mapped graph file) works the same
+    BFSResult<int> result5 = direction_optimizing_bfs(0, social.view());
+    cout << "Test 5 - Levels on a CSRGraphView match: " << (result5.level == expected ? "yes" : "no") << endl;
+
+    // Test Case 6: Adjacency list entry point on a directed graph: a hub
+    // 0 -> 1..2000 and i -> i + 2000, compared with bfs()
+    const int kDirected = 4001;
+    vector<vector<int>> directed_adj(kDirected);
+    for (int i = 1; i <= 2000; i++) {
+        directed_adj[0].push_back(i);
+        directed_adj[i].push_back(i + 2000);
+    }
+    vector<int> expected6 = bfs(0, directed_adj, kDirected);
+    vector<int> result6 = direction_optimizing_bfs(0, directed_adj, kDirected);
+    sort(expected6.begin(), expected6.end());
+    sort(result6.begin(), result6.end());
+    cout << "Test 6 - Directed adjacency list visits match bfs(): " << (result6 == expected6 ? "yes" : "no")
+         << " (" << result6.size() << " vertices)" << endl;
+
+    return 0;
+}
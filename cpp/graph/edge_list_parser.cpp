@@ -0,0 +1,197 @@
+/*
+ * Parallel Edge List Parser Examples
+ *
+ * Description:
+ * Parses SNAP and Matrix Market edge lists into CSR graphs (see
+ * edge_list_parser.h) and compares the parallel parser with the usual
+ * ifstream >> u >> v loop on a large generated file.
+ *
+ * Usage:
+ *     ./edge_list_parser                         examples and benchmark
+ *     ./edge_list_parser input output [threads]  convert an edge list to a
+ *                                                binary graph file
+ *
+ * Time Complexity: O((S + E log d) / p) for S bytes of text and p threads
+ * Space Complexity: O(V + E)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "edge_list_parser.h"
+#include "graph_file.h"
+using namespace std;
+
+/**
+ * Parses an edge list held in a string
+ */
+CSRGraph<int> parse_text(const string& text, ThreadPool& pool,
+                         const EdgeListOptions& options = EdgeListOptions()) {
+    return parse_edge_list<int>(text.data(), text.size(), pool, options);
+}
+
+/**
+ * Reads an edge list with iostreams and builds the graph with
+ * CSRGraph::from_edge_list (the single-threaded baseline)
+ */
+CSRGraph<int> read_with_ifstream(const string& path) {
+    ifstream in(path);
+    vector<pair<int, int>> edges;
+    int largest = -1;
+    int u;
+    int v;
+    while (in >> u >> v) {
+        edges.push_back({u, v});
+        largest = max(largest, max(u, v));
+    }
+    return CSRGraph<int>::from_edge_list(largest + 1, edges);
+}
+
+/**
+ * True if both graphs have the same neighbors for every vertex, in any order
+ */
+bool same_neighbor_sets(const CSRGraph<int>& a, const CSRGraph<int>& b) {
+    if (a.num_vertices() != b.num_vertices() || a.num_edges() != b.num_edges()) {
+        return false;
+    }
+    vector<int> x;
+    vector<int> y;
+    for (int v = 0; v < a.num_vertices(); v++) {
+        x.assign(a.neighbors(v).begin(), a.neighbors(v).end());
+        y.assign(b.neighbors(v).begin(), b.neighbors(v).end());
+        sort(x.begin(), x.end());
+        sort(y.begin(), y.end());
+        if (x != y) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Prints the adjacency list of a graph
+ */
+void print_graph(const CSRGraph<int>& graph) {
+    vector<vector<int>> adj = graph.to_adjacency_list();
+    for (size_t u = 0; u < adj.size(); u++) {
+        cout << "  " << u << ":";
+        for (int v : adj[u]) {
+            cout << " " << v;
+        }
+        cout << endl;
+    }
+}
+
+/**
+ * Converts an edge list file to a binary graph file
+ */
+int convert(const string& input, const string& output, unsigned threads) {
+    ThreadPool pool(threads);
+    auto t0 = chrono::steady_clock::now();
+    CSRGraph<int> graph = parse_edge_list_file<int>(input, pool);
+    auto t1 = chrono::steady_clock::now();
+    write_graph_file(output, graph);
+    cout << graph.num_vertices() << " vertices, " << graph.num_edges() << " edges parsed in "
+         << chrono::duration<double, milli>(t1 - t0).count() << " ms" << endl;
+    return 0;
+}
+
+// Example usage and test cases
+int main(int argc, char* argv[]) {
+    if (argc >= 3) {
+        return convert(argv[1], argv[2], argc >= 4 ? static_cast<unsigned>(atoi(argv[3])) : 0);
+    }
+
+    cout << "=== Parallel Edge List Parser Examples ===" << endl << endl;
+    ThreadPool pool;
+
+    // Test Case 1: SNAP edge list with comments, tabs and Windows line ends
+    string snap =
+        "# Directed graph: example.txt\n"
+        "# FromNodeId\tToNodeId\n"
+        "0\t1\r\n"
+        "0\t2\r\n"
+        "2\t3\r\n"
+        "1\t3\r\n";
+    cout << "Test 1 - SNAP edge list:" << endl;
+    print_graph(parse_text(snap, pool));
+    cout << endl;
+
+    // Test Case 2: Symmetric Matrix Market file (1-based, with values)
+    string matrix_market =
+        "%%MatrixMarket matrix coordinate real symmetric\n"
+        "% lower triangle only\n"
+        "4 4 4\n"
+        "2 1 0.5\n"
+        "3 1 1.0\n"
+        "4 3 2.5\n"
+        "4 4 1.0\n";
+    cout << "Test 2 - Symmetric Matrix Market file:" << endl;
+    print_graph(parse_text(matrix_market, pool));
+    cout << endl;
+
+    // Test Case 3: Symmetrize, drop self-loops and duplicates
+    string messy = "0 1\n1 0\n0 1\n2 2\n1 2\n";
+    EdgeListOptions options;
+    options.symmetrize = true;
+    options.remove_self_loops = true;
+    options.deduplicate = true;
+    cout << "Test 3 - Messy edge list, symmetrized and cleaned:" << endl;
+    print_graph(parse_text(messy, pool, options));
+    cout << endl;
+
+    // Test Case 4: Malformed input
+    cout << "Test 4 - Malformed line:" << endl;
+    try {
+        parse_text("0 1\n1 2\n2 x\n", pool);
+    } catch (const runtime_error& error) {
+        cout << "  error: " << error.what() << endl;
+    }
+    cout << endl;
+
+    // Test Case 5: Large generated file, iostreams vs parallel parser
+    const int kVertices = 1000000;
+    const int kEdges = 5000000;
+    string path = (filesystem::temp_directory_path() / "algovault_edge_list.txt").string();
+    {
+        mt19937 rng(5);
+        FILE* out = fopen(path.c_str(), "w");
+        for (int i = 0; i < kEdges; i++) {
+            fprintf(out, "%u\t%u\n", static_cast<unsigned>(rng() % kVertices),
+                    static_cast<unsigned>(rng() % kVertices));
+        }
+        fclose(out);
+    }
+
+    auto t0 = chrono::steady_clock::now();
+    CSRGraph<int> expected = read_with_ifstream(path);
+    auto t1 = chrono::steady_clock::now();
+    cout << "Test 5 - " << kEdges << " edges, " << filesystem::file_size(path) / (1 << 20)
+         << " MiB of text:" << endl;
+    cout << "  ifstream + from_edge_list: " << chrono::duration<double, milli>(t1 - t0).count()
+         << " ms" << endl;
+
+    bool all_match = true;
+    for (unsigned threads = 1; threads <= pool.size(); threads *= 2) {
+        ThreadPool parse_pool(threads);
+        auto t2 = chrono::steady_clock::now();
+        CSRGraph<int> parsed = parse_edge_list_file<int>(path, parse_pool);
+        auto t3 = chrono::steady_clock::now();
+        all_match = all_match && same_neighbor_sets(parsed, expected);
+        cout << "  parallel parser, " << threads << " thread(s): "
+             << chrono::duration<double, milli>(t3 - t2).count() << " ms" << endl;
+    }
+    cout << "Graphs match: " << (all_match ? "yes" : "no") << endl;
+    filesystem::remove(path);
+
+    return 0;
+}
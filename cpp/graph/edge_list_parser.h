@@ -0,0 +1,368 @@
+/*
+ * Parallel Edge List Parser
+ *
+ * Description:
+ * Reads text edge lists, one edge "u v" per line, into a CSR graph:
+ *
+ *   - SNAP style: 0-based ids, comment lines start with '#'
+ *   - Matrix Market coordinate files (banner "%%MatrixMarket matrix
+ *     coordinate ..."): '%' comments, a "rows cols entries" size line,
+ *     1-based ids. Symmetric files store every edge once, so they are
+ *     symmetrized automatically.
+ *
+ * Anything after the second id (weights, values) is ignored. Ids may be
+ * separated by spaces, tabs or commas.
+ *
+ * The input is memory-mapped and split at line starts into chunks that the
+ * threads of a ThreadPool parse independently, with a hand-written digit
+ * loop instead of iostreams (no locale, no virtual calls, no copies). The
+ * CSR arrays are then built in parallel without atomics (an atomic
+ * increment per edge at a random vertex stalls on every cache miss):
+ *   1. the edges of every chunk are partitioned by source vertex block
+ *      (blocks of 2^k consecutive ids), like one pass of a radix sort
+ *   2. every block counts the degrees of its own vertices; a prefix sum
+ *      turns them into offsets
+ *   3. every block scatters its edges into its vertices' lists and sorts
+ *      them; on request duplicates are dropped and the arrays compacted
+ * Neighbor lists come out sorted, so the result does not depend on the
+ * number of threads.
+ *
+ * Time Complexity: O((S + E log d) / p) for S bytes of text, E edges,
+ *   maximum degree d and p threads, plus O(V) for the prefix sums
+ * Space Complexity: O(V + E)
+ */
+
+#ifndef ALGOVAULT_GRAPH_EDGE_LIST_PARSER_H
+#define ALGOVAULT_GRAPH_EDGE_LIST_PARSER_H
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../parallel/thread_pool.h"
+#include "csr_graph.h"
+#include "mapped_file.h"
+
+// Smallest piece of text handed to one thread
+const std::size_t kEdgeListChunkBytes = 1 << 20;
+
+// Chunks per thread, so threads that finish early can take more
+const std::size_t kEdgeListChunksPerThread = 8;
+
+// Vertices per block when building the CSR arrays (cursors fit in L2)
+const std::size_t kEdgeListBlockVertices = 1 << 16;
+
+// Vertices per task when compacting neighbor lists
+const std::size_t kEdgeListVertexGrain = 1 << 14;
+
+/**
+ * How edges are turned into the graph
+ * - symmetrize: also add v -> u for every edge u -> v
+ * - remove_self_loops: drop edges u -> u
+ * - deduplicate: keep one copy of repeated edges
+ * - num_vertices: vertex count, -1 = largest id + 1 (or the Matrix Market size)
+ */
+struct EdgeListOptions {
+    bool symmetrize = false;
+    bool remove_self_loops = false;
+    bool deduplicate = false;
+    std::int64_t num_vertices = -1;
+};
+
+/**
+ * Edges parsed from one chunk of the input
+ */
+template <typename VertexId>
+struct EdgeListChunk {
+    std::vector<std::pair<VertexId, VertexId>> edges;
+    std::int64_t largest_id = -1;
+    const char* error = nullptr;  // start of the first malformed line
+};
+
+/**
+ * Parses an unsigned decimal number at p and moves p past it
+ * @return false if p is not at a digit or the number has over 18 digits
+ */
+inline bool parse_edge_list_number(const char*& p, const char* end, std::uint64_t& value) {
+    const char* first = p;
+    std::uint64_t result = 0;
+    while (p != end && static_cast<unsigned>(*p - '0') <= 9) {
+        result = result * 10 + static_cast<unsigned>(*p - '0');
+        p++;
+    }
+    value = result;
+    return p != first && p - first <= 18;
+}
+
+inline bool is_edge_list_separator(char c) { return c == ' ' || c == '\t' || c == ','; }
+
+/**
+ * Parses the lines in [begin, end); begin is at the start of a line
+ * @param id_base: id of the first vertex in the file (0 or 1)
+ */
+template <typename VertexId>
+void parse_edge_list_chunk(const char* begin, const char* end, std::uint64_t id_base,
+                           bool remove_self_loops, EdgeListChunk<VertexId>& chunk) {
+    // Largest id whose vertex count still fits in VertexId
+    const std::uint64_t max_id = static_cast<std::uint64_t>(std::numeric_limits<VertexId>::max()) - 1;
+    const char* p = begin;
+    while (p < end) {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) {
+            p++;
+        }
+        if (p < end && *p != '\n' && *p != '#' && *p != '%') {
+            const char* line = p;
+            std::uint64_t u = 0;
+            std::uint64_t v = 0;
+            bool ok = parse_edge_list_number(p, end, u) && p < end && is_edge_list_separator(*p);
+            while (p < end && is_edge_list_separator(*p)) {
+                p++;
+            }
+            ok = ok && parse_edge_list_number(p, end, v) &&
+                 (p == end || is_edge_list_separator(*p) || *p == '\r' || *p == '\n') &&
+                 u >= id_base && v >= id_base && u - id_base <= max_id && v - id_base <= max_id;
+            if (!ok) {
+                chunk.error = line;
+                return;
+            }
+            u -= id_base;
+            v -= id_base;
+            chunk.largest_id = std::max(chunk.largest_id, static_cast<std::int64_t>(std::max(u, v)));
+            if (u != v || !remove_self_loops) {
+                chunk.edges.push_back({static_cast<VertexId>(u), static_cast<VertexId>(v)});
+            }
+        }
+        const void* newline = p < end ? std::memchr(p, '\n', static_cast<std::size_t>(end - p)) : nullptr;
+        p = newline == nullptr ? end : static_cast<const char*>(newline) + 1;
+    }
+}
+
+/**
+ * Position just after the line containing pos
+ */
+inline std::size_t edge_list_next_line(const char* data, std::size_t size, std::size_t pos) {
+    const void* newline = pos < size ? std::memchr(data + pos, '\n', size - pos) : nullptr;
+    return newline == nullptr ? size : static_cast<std::size_t>(static_cast<const char*>(newline) - data) + 1;
+}
+
+/**
+ * Builds a CSR graph from an edge list in memory
+ *
+ * @param data, size: text of the edge list
+ * @param pool: threads used for parsing and building
+ * @param options: symmetrization, self-loop removal, deduplication, size
+ * @return the graph, with sorted neighbor lists
+ */
+template <typename VertexId = std::int32_t>
+CSRGraph<VertexId> parse_edge_list(const char* data, std::size_t size, ThreadPool& pool,
+                                   const EdgeListOptions& options = EdgeListOptions()) {
+    using edge_index = typename CSRGraph<VertexId>::edge_index;
+    std::size_t body = 0;
+    std::uint64_t id_base = 0;
+    bool symmetrize = options.symmetrize;
+    std::int64_t num_vertices = options.num_vertices;
+
+    // Matrix Market: banner, comments and size line come before the edges
+    const char kBanner[] = "%%MatrixMarket";
+    if (size >= sizeof(kBanner) - 1 && std::memcmp(data, kBanner, sizeof(kBanner) - 1) == 0) {
+        body = edge_list_next_line(data, size, 0);
+        std::string banner(data, body);
+        std::transform(banner.begin(), banner.end(), banner.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        if (banner.find("coordinate") == std::string::npos) {
+            throw std::runtime_error("parse_edge_list: only coordinate Matrix Market files are edge lists");
+        }
+        // "symmetric", "skew-symmetric" and "hermitian" store one triangle
+        symmetrize = symmetrize || banner.find("symmetric") != std::string::npos ||
+                     banner.find("hermitian") != std::string::npos;
+        id_base = 1;
+
+        while (body < size && (data[body] == '%' || data[body] == '\n' || data[body] == '\r')) {
+            body = edge_list_next_line(data, size, body);
+        }
+        const char* p = data + body;
+        const char* end = data + size;
+        std::uint64_t rows = 0;
+        std::uint64_t columns = 0;
+        bool ok = parse_edge_list_number(p, end, rows);
+        while (p < end && is_edge_list_separator(*p)) {
+            p++;
+        }
+        ok = ok && parse_edge_list_number(p, end, columns);
+        if (!ok) {
+            throw std::runtime_error("parse_edge_list: missing Matrix Market size line");
+        }
+        if (num_vertices < 0) {
+            num_vertices = static_cast<std::int64_t>(std::max(rows, columns));
+        }
+        body = edge_list_next_line(data, size, body);
+    }
+
+    // Chunks start at line starts: each boundary moves to the next line
+    const std::size_t chunk_count = std::max<std::size_t>(
+        1, std::min<std::size_t>(pool.size() * kEdgeListChunksPerThread,
+                                 (size - body) / kEdgeListChunkBytes));
+    std::vector<std::size_t> bounds(chunk_count + 1, size);
+    bounds[0] = body;
+    for (std::size_t c = 1; c < chunk_count; c++) {
+        const std::size_t pos = body + (size - body) / chunk_count * c;
+        bounds[c] = std::max(bounds[c - 1], data[pos - 1] == '\n' ? pos : edge_list_next_line(data, size, pos));
+    }
+
+    std::vector<EdgeListChunk<VertexId>> chunks(chunk_count);
+    pool.parallel_for(0, chunk_count, 1, [&](unsigned, std::size_t lo, std::size_t hi) {
+        for (std::size_t c = lo; c < hi; c++) {
+            parse_edge_list_chunk(data + bounds[c], data + bounds[c + 1], id_base,
+                                  options.remove_self_loops, chunks[c]);
+        }
+    });
+
+    std::int64_t largest_id = -1;
+    for (const EdgeListChunk<VertexId>& chunk : chunks) {
+        if (chunk.error != nullptr) {
+            const std::size_t line = static_cast<std::size_t>(std::count(data, chunk.error, '\n')) + 1;
+            throw std::runtime_error("parse_edge_list: line " + std::to_string(line) +
+                                     ": expected two vertex ids");
+        }
+        largest_id = std::max(largest_id, chunk.largest_id);
+    }
+    if (num_vertices < 0) {
+        num_vertices = largest_id + 1;
+    }
+    if (largest_id >= num_vertices) {
+        throw std::out_of_range("parse_edge_list: vertex id " + std::to_string(largest_id + id_base) +
+                                " is out of range");
+    }
+    if (num_vertices > static_cast<std::int64_t>(std::numeric_limits<VertexId>::max())) {
+        throw std::out_of_range("parse_edge_list: too many vertices for the vertex id type");
+    }
+    const std::size_t n = static_cast<std::size_t>(num_vertices);
+
+    // Vertices are split into blocks of 2^shift ids: at least one block per
+    // chunk, and small enough that a block's cursors stay in cache
+    const std::size_t target_blocks = std::max(chunk_count, n / kEdgeListBlockVertices);
+    unsigned shift = 0;
+    while ((n >> shift) >= target_blocks) {
+        shift++;
+    }
+    const std::size_t block_count = (n >> shift) + 1;
+    auto for_each_edge = [&](const EdgeListChunk<VertexId>& chunk, auto&& emit) {
+        for (const auto& edge : chunk.edges) {
+            emit(edge.first, edge.second);
+            // The reverse of a self-loop would be the same edge again
+            if (symmetrize && edge.first != edge.second) {
+                emit(edge.second, edge.first);
+            }
+        }
+    };
+
+    // 1. Group the edges by source block: count per (chunk, block), prefix
+    //    sum in block-major order, scatter (sequential streams, no atomics)
+    std::vector<edge_index> cursor(chunk_count * block_count, 0);
+    pool.parallel_for(0, chunk_count, 1, [&](unsigned, std::size_t lo, std::size_t hi) {
+        for (std::size_t c = lo; c < hi; c++) {
+            edge_index* count = cursor.data() + c * block_count;
+            for_each_edge(chunks[c], [&](VertexId u, VertexId) {
+                count[static_cast<std::size_t>(u) >> shift]++;
+            });
+        }
+    });
+    std::vector<edge_index> block_start(block_count + 1, 0);
+    edge_index total = 0;
+    for (std::size_t b = 0; b < block_count; b++) {
+        block_start[b] = total;
+        for (std::size_t c = 0; c < chunk_count; c++) {
+            const edge_index count = cursor[c * block_count + b];
+            cursor[c * block_count + b] = total;
+            total += count;
+        }
+    }
+    block_start[block_count] = total;
+
+    std::vector<std::pair<VertexId, VertexId>> grouped(static_cast<std::size_t>(total));
+    pool.parallel_for(0, chunk_count, 1, [&](unsigned, std::size_t lo, std::size_t hi) {
+        for (std::size_t c = lo; c < hi; c++) {
+            edge_index* next = cursor.data() + c * block_count;
+            for_each_edge(chunks[c], [&](VertexId u, VertexId v) {
+                grouped[next[static_cast<std::size_t>(u) >> shift]++] = {u, v};
+            });
+            chunks[c].edges = std::vector<std::pair<VertexId, VertexId>>();  // free early
+        }
+    });
+
+    // 2. Degrees: each block counts only its own vertices
+    std::vector<edge_index> offsets(n + 1, 0);
+    pool.parallel_for(0, block_count, 1, [&](unsigned, std::size_t lo, std::size_t hi) {
+        for (std::size_t e = block_start[lo]; e < block_start[hi]; e++) {
+            offsets[static_cast<std::size_t>(grouped[e].first) + 1]++;
+        }
+    });
+    for (std::size_t v = 0; v < n; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+
+    // 3. Scatter each block into its vertices' lists and sort every list
+    //    (edges of a block arrive in chunk order, sorting makes the result
+    //    independent of the chunking); with deduplicate, kept[v] becomes the
+    //    number of distinct neighbors
+    std::vector<VertexId> neighbors(static_cast<std::size_t>(total));
+    std::vector<edge_index> kept(n, 0);
+    pool.parallel_for(0, block_count, 1, [&](unsigned, std::size_t lo, std::size_t hi) {
+        const std::size_t first_vertex = std::min(n, lo << shift);
+        const std::size_t last_vertex = std::min(n, hi << shift);
+        std::vector<edge_index> next(offsets.begin() + static_cast<std::ptrdiff_t>(first_vertex),
+                                     offsets.begin() + static_cast<std::ptrdiff_t>(last_vertex));
+        for (std::size_t e = block_start[lo]; e < block_start[hi]; e++) {
+            neighbors[next[static_cast<std::size_t>(grouped[e].first) - first_vertex]++] = grouped[e].second;
+        }
+        for (std::size_t v = first_vertex; v < last_vertex; v++) {
+            VertexId* first = neighbors.data() + offsets[v];
+            VertexId* last = neighbors.data() + offsets[v + 1];
+            std::sort(first, last);
+            kept[v] = options.deduplicate ? static_cast<edge_index>(std::unique(first, last) - first)
+                                          : static_cast<edge_index>(last - first);
+        }
+    });
+    grouped = std::vector<std::pair<VertexId, VertexId>>();
+    if (!options.deduplicate) {
+        return CSRGraph<VertexId>(std::move(offsets), std::move(neighbors));
+    }
+
+    // 4. Compact the deduplicated lists
+    std::vector<edge_index> kept_offsets(n + 1, 0);
+    for (std::size_t v = 0; v < n; v++) {
+        kept_offsets[v + 1] = kept_offsets[v] + kept[v];
+    }
+    std::vector<VertexId> compacted(static_cast<std::size_t>(kept_offsets[n]));
+    pool.parallel_for(0, n, kEdgeListVertexGrain, [&](unsigned, std::size_t lo, std::size_t hi) {
+        for (std::size_t v = lo; v < hi; v++) {
+            const VertexId* first = neighbors.data() + offsets[v];
+            std::copy(first, first + kept[v], compacted.data() + kept_offsets[v]);
+        }
+    });
+    return CSRGraph<VertexId>(std::move(kept_offsets), std::move(compacted));
+}
+
+/**
+ * Builds a CSR graph from an edge list file (SNAP or Matrix Market)
+ *
+ * @param path: text file, memory-mapped while parsing
+ * @param pool: threads used for parsing and building
+ * @param options: symmetrization, self-loop removal, deduplication, size
+ * @return the graph, with sorted neighbor lists
+ */
+template <typename VertexId = std::int32_t>
+CSRGraph<VertexId> parse_edge_list_file(const std::string& path, ThreadPool& pool,
+                                        const EdgeListOptions& options = EdgeListOptions()) {
+    MappedFile file(path);
+    file.advise_sequential();
+    return parse_edge_list<VertexId>(file.data(), file.size(), pool, options);
+}
+
+#endif // ALGOVAULT_GRAPH_EDGE_LIST_PARSER_H
@@ -0,0 +1,84 @@
+/*
+ * Directed Cycle Finding (iterative DFS)
+ *
+ * Description:
+ * Depth first search colors every vertex white (not seen), gray (on the
+ * current DFS path) or black (finished). An edge into a gray vertex closes
+ * a cycle, and that cycle is exactly the part of the DFS path from the gray
+ * vertex to the current one.
+ *
+ * The DFS keeps its own explicit stack, so long dependency chains cannot
+ * overflow the call stack. It works on any graph representation through a
+ * callback returning the out-neighbors of a vertex, as long as the returned
+ * range supports size() and operator[] (vector<int>, CSRGraph neighbors).
+ *
+ * Time Complexity: O(V + E)
+ * Space Complexity: O(V)
+ */
+
+#ifndef ALGOVAULT_GRAPH_FIND_CYCLE_H
+#define ALGOVAULT_GRAPH_FIND_CYCLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * Finds one directed cycle in a graph
+ *
+ * @param num_vertices: number of vertices
+ * @param neighbors: callable, neighbors(u) returns the out-neighbors of u
+ * @return vertices of a cycle [c0, c1, ..., ck] with edges c0 -> c1 -> ...
+ *         -> ck -> c0, or an empty vector if the graph is acyclic
+ */
+template <typename VertexId, typename NeighborFn>
+std::vector<VertexId> find_cycle(VertexId num_vertices, NeighborFn neighbors) {
+    enum : std::uint8_t { kWhite, kGray, kBlack };
+    const std::size_t n = static_cast<std::size_t>(num_vertices);
+    std::vector<std::uint8_t> color(n, kWhite);
+
+    // DFS path: (vertex, index of the next neighbor to look at)
+    std::vector<std::pair<VertexId, std::size_t>> path;
+
+    for (std::size_t root = 0; root < n; root++) {
+        if (color[root] != kWhite) {
+            continue;
+        }
+        color[root] = kGray;
+        path.push_back({static_cast<VertexId>(root), 0});
+
+        while (!path.empty()) {
+            const VertexId u = path.back().first;
+            const auto& out = neighbors(u);
+
+            if (path.back().second == out.size()) {
+                color[static_cast<std::size_t>(u)] = kBlack;
+                path.pop_back();
+                continue;
+            }
+
+            const VertexId v = out[path.back().second++];
+            const std::size_t vi = static_cast<std::size_t>(v);
+            if (color[vi] == kWhite) {
+                color[vi] = kGray;
+                path.push_back({v, 0});
+            } else if (color[vi] == kGray) {
+                // Back edge u -> v: the cycle is the path from v to u
+                std::size_t i = path.size();
+                while (path[i - 1].first != v) {
+                    i--;
+                }
+                std::vector<VertexId> cycle;
+                for (std::size_t j = i - 1; j < path.size(); j++) {
+                    cycle.push_back(path[j].first);
+                }
+                return cycle;
+            }
+        }
+    }
+
+    return {};
+}
+
+#endif // ALGOVAULT_GRAPH_FIND_CYCLE_H
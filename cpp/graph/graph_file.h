@@ -0,0 +1,230 @@
+/*
+ * Binary Graph File with memory-mapped loading
+ *
+ * Description:
+ * Parsing a text edge list and building a CSR graph takes minutes on a
+ * graph with billions of edges. This file format stores the CSR arrays
+ * themselves, so loading is a single mmap(): the operating system pages in
+ * the parts of the file a traversal actually touches, and nothing is parsed
+ * or copied. MappedGraph::graph() returns a CSRGraphView over the mapping
+ * that BFS and topological sort accept like any CSRGraph.
+ *
+ * Layout (native byte order, every section starts at a multiple of 8):
+ *
+ *     GraphFileHeader       64 bytes: magic, version, sizes, section starts
+ *     offsets               (V + 1) x uint64
+ *     neighbors             E x VertexId (4 or 8 bytes)
+ *     weights (optional)    E x float, weights[e] belongs to neighbors[e]
+ *
+ * Opening a file checks the header and the section sizes in O(1). The
+ * O(V + E) check of every offset and vertex id is optional, since it would
+ * read the whole file.
+ *
+ * Time Complexity: O(V + E) to write, O(1) to map (+ O(V + E) to check)
+ * Space Complexity: O(1) besides the page cache
+ */
+
+#ifndef ALGOVAULT_GRAPH_GRAPH_FILE_H
+#define ALGOVAULT_GRAPH_GRAPH_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "csr_graph.h"
+#include "mapped_file.h"
+
+const char kGraphFileMagic[8] = {'A', 'V', 'G', 'R', 'A', 'P', 'H', '\0'};
+const std::uint32_t kGraphFileVersion = 1;
+
+/**
+ * First 64 bytes of a graph file; all positions are byte offsets
+ * from the start of the file
+ */
+struct GraphFileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t vertex_bytes;  // sizeof(VertexId) of the neighbor array
+    std::uint64_t num_vertices;
+    std::uint64_t num_edges;
+    std::uint64_t offsets_start;
+    std::uint64_t neighbors_start;
+    std::uint64_t weights_start;  // 0 if the graph has no weights
+    std::uint64_t file_size;
+};
+
+static_assert(sizeof(GraphFileHeader) == 64, "graph file header must be 64 bytes");
+
+/**
+ * Header describing a graph with the given sizes
+ */
+inline GraphFileHeader make_graph_file_header(std::uint64_t num_vertices, std::uint64_t num_edges,
+                                              std::uint32_t vertex_bytes, bool weighted) {
+    auto align8 = [](std::uint64_t position) { return (position + 7) / 8 * 8; };
+    GraphFileHeader header;
+    std::memcpy(header.magic, kGraphFileMagic, sizeof(header.magic));
+    header.version = kGraphFileVersion;
+    header.vertex_bytes = vertex_bytes;
+    header.num_vertices = num_vertices;
+    header.num_edges = num_edges;
+    header.offsets_start = sizeof(GraphFileHeader);
+    header.neighbors_start = header.offsets_start + (num_vertices + 1) * sizeof(std::uint64_t);
+    const std::uint64_t neighbors_end = header.neighbors_start + num_edges * vertex_bytes;
+    header.weights_start = weighted ? align8(neighbors_end) : 0;
+    header.file_size = weighted ? header.weights_start + num_edges * sizeof(float) : neighbors_end;
+    return header;
+}
+
+/**
+ * Writes a CSR graph as a binary graph file
+ *
+ * @param path: output file (overwritten)
+ * @param graph: graph to store
+ * @param weights: optional, one weight per edge in neighbor array order
+ */
+template <typename VertexId>
+void write_graph_file(const std::string& path, const CSRGraph<VertexId>& graph,
+                      const std::vector<float>* weights = nullptr) {
+    if (weights != nullptr && weights->size() != graph.num_edges()) {
+        throw std::invalid_argument("write_graph_file: need one weight per edge");
+    }
+    const GraphFileHeader header =
+        make_graph_file_header(static_cast<std::uint64_t>(graph.num_vertices()), graph.num_edges(),
+                               sizeof(VertexId), weights != nullptr);
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        throw std::runtime_error("write_graph_file: cannot open " + path);
+    }
+    const std::vector<std::uint64_t>& offsets = graph.offsets();
+    const std::vector<VertexId>& neighbors = graph.neighbor_array();
+    const char padding[8] = {};
+    const std::size_t neighbors_end = header.neighbors_start + neighbors.size() * sizeof(VertexId);
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+              std::fwrite(offsets.data(), sizeof(std::uint64_t), offsets.size(), file) == offsets.size() &&
+              std::fwrite(neighbors.data(), sizeof(VertexId), neighbors.size(), file) == neighbors.size();
+    if (ok && weights != nullptr) {
+        const std::size_t pad = header.weights_start - neighbors_end;
+        ok = std::fwrite(padding, 1, pad, file) == pad &&
+             std::fwrite(weights->data(), sizeof(float), weights->size(), file) == weights->size();
+    }
+    if (std::fclose(file) != 0 || !ok) {
+        throw std::runtime_error("write_graph_file: write error in " + path);
+    }
+}
+
+/**
+ * Read-only graph backed by a memory-mapped graph file
+ *
+ * The mapping lives as long as the object; views returned by graph() must
+ * not outlive it. Movable (the mapping does not move), not copyable.
+ */
+template <typename VertexId = std::int32_t>
+class MappedGraph {
+public:
+    /**
+     * Maps a graph file
+     * @param path: file written by write_graph_file with the same VertexId
+     * @param full_check: also check every offset and vertex id (reads the
+     *                    whole file)
+     */
+    explicit MappedGraph(const std::string& path, bool full_check = false) : file_(path) {
+        attach(path, full_check);
+    }
+
+    /**
+     * @return zero-copy view of the graph, valid while this object lives
+     */
+    const CSRGraphView<VertexId>& graph() const { return view_; }
+
+    VertexId num_vertices() const { return view_.num_vertices(); }
+
+    std::uint64_t num_edges() const { return view_.num_edges(); }
+
+    bool weighted() const { return weights_ != nullptr; }
+
+    /**
+     * @return weights of the out-edges of v: weights(v)[i] belongs to the
+     *         edge to graph().neighbors(v)[i]; nullptr if unweighted
+     */
+    const float* weights(VertexId v) const {
+        return weights_ == nullptr ? nullptr : weights_ + view_.offsets()[static_cast<std::size_t>(v)];
+    }
+
+    /**
+     * @return the file header
+     */
+    const GraphFileHeader& header() const { return header_; }
+
+private:
+    void attach(const std::string& path, bool full_check) {
+        const char* data = file_.data();
+        const std::size_t size = file_.size();
+        if (size < sizeof(GraphFileHeader)) {
+            throw std::runtime_error("MappedGraph: " + path + " is not a graph file");
+        }
+        std::memcpy(&header_, data, sizeof(header_));
+        if (std::memcmp(header_.magic, kGraphFileMagic, sizeof(kGraphFileMagic)) != 0) {
+            throw std::runtime_error("MappedGraph: " + path + " is not a graph file");
+        }
+        if (header_.version != kGraphFileVersion) {
+            throw std::runtime_error("MappedGraph: unsupported version of " + path);
+        }
+        if (header_.vertex_bytes != sizeof(VertexId)) {
+            throw std::runtime_error("MappedGraph: " + path + " has " +
+                                     std::to_string(header_.vertex_bytes) +
+                                     "-byte vertex ids, expected " + std::to_string(sizeof(VertexId)));
+        }
+        if (header_.num_vertices > static_cast<std::uint64_t>(std::numeric_limits<VertexId>::max())) {
+            throw std::runtime_error("MappedGraph: too many vertices in " + path);
+        }
+
+        // Section starts must match the sizes, so every array lies inside the
+        // file (sizes larger than the file are rejected first: no overflow)
+        if (header_.num_vertices >= size || header_.num_edges > size) {
+            throw std::runtime_error("MappedGraph: " + path + " is truncated or corrupt");
+        }
+        const GraphFileHeader expected = make_graph_file_header(
+            header_.num_vertices, header_.num_edges, header_.vertex_bytes, header_.weights_start != 0);
+        if (header_.offsets_start != expected.offsets_start ||
+            header_.neighbors_start != expected.neighbors_start ||
+            header_.weights_start != expected.weights_start ||
+            header_.file_size != expected.file_size || header_.file_size > size) {
+            throw std::runtime_error("MappedGraph: " + path + " is truncated or corrupt");
+        }
+
+        const std::uint64_t* offsets = reinterpret_cast<const std::uint64_t*>(data + header_.offsets_start);
+        const VertexId* neighbors = reinterpret_cast<const VertexId*>(data + header_.neighbors_start);
+        if (offsets[0] != 0 || offsets[header_.num_vertices] != header_.num_edges) {
+            throw std::runtime_error("MappedGraph: " + path + " has invalid offsets");
+        }
+        view_ = CSRGraphView<VertexId>(static_cast<VertexId>(header_.num_vertices), offsets, neighbors);
+        weights_ = header_.weights_start == 0
+                       ? nullptr
+                       : reinterpret_cast<const float*>(data + header_.weights_start);
+
+        if (full_check) {
+            for (std::uint64_t v = 0; v < header_.num_vertices; v++) {
+                if (offsets[v + 1] < offsets[v]) {
+                    throw std::runtime_error("MappedGraph: " + path + " has invalid offsets");
+                }
+            }
+            for (VertexId u : view_.neighbor_array()) {
+                if (u < 0 || static_cast<std::uint64_t>(u) >= header_.num_vertices) {
+                    throw std::runtime_error("MappedGraph: " + path + " has invalid vertex ids");
+                }
+            }
+        }
+    }
+
+    MappedFile file_;
+    GraphFileHeader header_ = {};
+    CSRGraphView<VertexId> view_;
+    const float* weights_ = nullptr;
+};
+
+#endif // ALGOVAULT_GRAPH_GRAPH_FILE_H
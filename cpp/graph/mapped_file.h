@@ -0,0 +1,105 @@
+/*
+ * Read-only Memory-Mapped File
+ *
+ * Description:
+ * Maps a whole file into the address space with mmap(). Pages are read
+ * from disk (or the page cache) the first time they are touched, so
+ * "loading" a file costs nothing up front and nothing is copied into
+ * process memory. Used by the graph file loader and the edge list parser.
+ *
+ * Time Complexity: O(1) to map
+ * Space Complexity: O(1) besides the page cache
+ */
+
+#ifndef ALGOVAULT_GRAPH_MAPPED_FILE_H
+#define ALGOVAULT_GRAPH_MAPPED_FILE_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * Read-only mapping of a file, unmapped on destruction. Movable, not
+ * copyable. An empty file has size() == 0 and data() == nullptr.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    /**
+     * @param path: file to map
+     */
+    explicit MappedFile(const std::string& path) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("MappedFile: cannot open " + path);
+        }
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw std::runtime_error("MappedFile: cannot stat " + path);
+        }
+        size_ = static_cast<std::size_t>(info.st_size);
+        if (size_ == 0) {
+            ::close(fd);
+            return;
+        }
+        void* data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);  // the mapping keeps the file open
+        if (data == MAP_FAILED) {
+            throw std::runtime_error("MappedFile: cannot map " + path);
+        }
+        data_ = static_cast<const char*>(data);
+    }
+
+    MappedFile(MappedFile&& other) noexcept : data_(other.data_), size_(other.size_) {
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            data_ = other.data_;
+            size_ = other.size_;
+            other.data_ = nullptr;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() { unmap(); }
+
+    const char* data() const { return data_; }
+
+    std::size_t size() const { return size_; }
+
+    /**
+     * Tells the kernel the file will be read front to back (more read-ahead)
+     */
+    void advise_sequential() const {
+        if (data_ != nullptr) {
+            ::madvise(const_cast<char*>(data_), size_, MADV_SEQUENTIAL);
+        }
+    }
+
+private:
+    void unmap() {
+        if (data_ != nullptr) {
+            ::munmap(const_cast<char*>(data_), size_);
+            data_ = nullptr;
+        }
+    }
+
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+#endif // ALGOVAULT_GRAPH_MAPPED_FILE_H
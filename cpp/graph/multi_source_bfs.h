@@ -0,0 +1,183 @@
+/*
+ * Multi-Source Bit-Parallel BFS (MS-BFS)
+ *
+ * Description:
+ * Computes hop distances from many sources at once. Running one BFS per
+ * source reads the whole graph once per source; MS-BFS runs up to 64 or
+ * 256 BFS "in lockstep" and reads every edge once per level for all of
+ * them together.
+ *
+ * Every vertex keeps three bitsets with one bit per source:
+ *   - seen:  sources that have already reached the vertex
+ *   - visit: sources whose frontier contains the vertex at this level
+ *   - next:  sources reaching the vertex in the next level
+ * One level is:
+ *   1. for every vertex v with visit[v] != 0 and every edge v -> u:
+ *          next[u] |= visit[v]            (all sources in one OR)
+ *   2. for every vertex u:
+ *          visit[u] = next[u] & ~seen[u]; seen[u] |= visit[u]
+ *      every bit set in the new visit[u] gives distance = level to u
+ *
+ * The bitset is one 64-bit word (64 sources) or four words (256 sources,
+ * which the compiler turns into AVX2 operations). More sources are
+ * processed in batches of 256.
+ *
+ * Time Complexity: O(L * (V + E) * W + S * V) per batch
+ *   for L levels, W words per bitset and S sources
+ * Space Complexity: O(V * W) bitsets + O(S * V) distances
+ */
+
+#ifndef ALGOVAULT_GRAPH_MULTI_SOURCE_BFS_H
+#define ALGOVAULT_GRAPH_MULTI_SOURCE_BFS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "csr_graph.h"
+
+/**
+ * Set of up to 64 * Words sources, one bit each
+ */
+template <std::size_t Words>
+struct SourceMask {
+    std::uint64_t word[Words] = {};
+
+    bool any() const {
+        std::uint64_t bits = 0;
+        for (std::size_t i = 0; i < Words; i++) {
+            bits |= word[i];
+        }
+        return bits != 0;
+    }
+
+    void set(std::size_t bit) { word[bit / 64] |= std::uint64_t{1} << (bit % 64); }
+
+    SourceMask& operator|=(const SourceMask& other) {
+        for (std::size_t i = 0; i < Words; i++) {
+            word[i] |= other.word[i];
+        }
+        return *this;
+    }
+
+    /**
+     * @return bits of this set that are not in other
+     */
+    SourceMask without(const SourceMask& other) const {
+        SourceMask result;
+        for (std::size_t i = 0; i < Words; i++) {
+            result.word[i] = word[i] & ~other.word[i];
+        }
+        return result;
+    }
+};
+
+/**
+ * Runs one batch of at most 64 * Words sources
+ *
+ * @param num_vertices: number of vertices
+ * @param sources: first source of the batch
+ * @param count: number of sources in the batch
+ * @param neighbors: callable, neighbors(v) returns the out-neighbors of v
+ * @param distance: distance[i][v] is set for every source i of the batch
+ */
+template <std::size_t Words, typename VertexId, typename NeighborFn>
+void multi_source_bfs_batch(VertexId num_vertices, const VertexId* sources, std::size_t count,
+                            NeighborFn& neighbors, std::vector<VertexId>* distance) {
+    const std::size_t n = static_cast<std::size_t>(num_vertices);
+    std::vector<SourceMask<Words>> seen(n);
+    std::vector<SourceMask<Words>> visit(n);
+    std::vector<SourceMask<Words>> next(n);
+
+    for (std::size_t i = 0; i < count; i++) {
+        const std::size_t s = static_cast<std::size_t>(sources[i]);
+        distance[i].assign(n, -1);
+        distance[i][s] = 0;
+        seen[s].set(i);
+        visit[s].set(i);
+    }
+
+    bool active = count > 0;
+    for (VertexId level = 1; active; level++) {
+        // 1. Every frontier edge is read once for all sources
+        for (std::size_t v = 0; v < n; v++) {
+            if (visit[v].any()) {
+                for (VertexId u : neighbors(static_cast<VertexId>(v))) {
+                    next[static_cast<std::size_t>(u)] |= visit[v];
+                }
+            }
+        }
+
+        // 2. Keep the sources that reach a vertex for the first time
+        active = false;
+        for (std::size_t u = 0; u < n; u++) {
+            visit[u] = next[u].without(seen[u]);
+            next[u] = SourceMask<Words>();
+            if (!visit[u].any()) {
+                continue;
+            }
+            active = true;
+            seen[u] |= visit[u];
+            for (std::size_t w = 0; w < Words; w++) {
+                for (std::uint64_t bits = visit[u].word[w]; bits != 0; bits &= bits - 1) {
+                    distance[w * 64 + static_cast<std::size_t>(__builtin_ctzll(bits))][u] = level;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Hop distances from many sources
+ *
+ * @param num_vertices: number of vertices
+ * @param sources: source vertices (any number, duplicates allowed)
+ * @param neighbors: callable, neighbors(v) returns the out-neighbors of v
+ *                   (return a reference or a view, not a copy)
+ * @return distance[i][v] = hops from sources[i] to v, -1 if unreachable
+ */
+template <typename VertexId, typename NeighborFn>
+std::vector<std::vector<VertexId>> multi_source_bfs(VertexId num_vertices,
+                                                    const std::vector<VertexId>& sources,
+                                                    NeighborFn neighbors) {
+    std::vector<std::vector<VertexId>> distance(sources.size());
+
+    // Up to 64 sources fit one word; beyond that use 256-source batches
+    if (sources.size() <= 64) {
+        multi_source_bfs_batch<1>(num_vertices, sources.data(), sources.size(), neighbors,
+                                  distance.data());
+        return distance;
+    }
+    for (std::size_t begin = 0; begin < sources.size(); begin += 256) {
+        const std::size_t count = std::min<std::size_t>(256, sources.size() - begin);
+        multi_source_bfs_batch<4>(num_vertices, sources.data() + begin, count, neighbors,
+                                  distance.data() + begin);
+    }
+    return distance;
+}
+
+/**
+ * Hop distances from many sources on a CSR graph
+ * @return distance[i][v] = hops from sources[i] to v, -1 if unreachable
+ */
+template <typename VertexId>
+std::vector<std::vector<VertexId>> multi_source_bfs(const CSRGraph<VertexId>& graph,
+                                                    const std::vector<VertexId>& sources) {
+    return multi_source_bfs(graph.num_vertices(), sources,
+                            [&graph](VertexId v) { return graph.neighbors(v); });
+}
+
+/**
+ * Hop distances from many sources on an adjacency list
+ *
+ * @param adj: adjacency list of the graph
+ * @param sources: source vertices
+ * @return distance[i][v] = hops from sources[i] to v, -1 if unreachable
+ */
+inline std::vector<std::vector<int>> multi_source_bfs(const std::vector<std::vector<int>>& adj,
+                                                      const std::vector<int>& sources) {
+    return multi_source_bfs(static_cast<int>(adj.size()), sources,
+                            [&adj](int v) -> const std::vector<int>& { return adj[v]; });
+}
+
+#endif // ALGOVAULT_GRAPH_MULTI_SOURCE_BFS_H
@@ -0,0 +1,167 @@
+/*
+ * Parallel BFS Examples
+ *
+ * Description:
+ * parallel_bfs() (see parallel_bfs.h) expands every BFS frontier on a
+ * thread pool, claiming vertices with an atomic minimum on their parent
+ * slot, so levels and parents are the same as a serial BFS whatever the
+ * thread schedule. The benchmark at the end measures thread scaling.
+ *
+ * Time Complexity: O(V + E) work, O(D) synchronization rounds
+ * Space Complexity: O(V)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+#include "csr_graph.h"
+#include "parallel_bfs.h"
+#include "../parallel/thread_pool.h"
+using namespace std;
+
+/**
+ * Serial BFS with the same parent rule (smallest-id parent), used to
+ * check the parallel results
+ */
+ParallelBFSResult<int> serial_bfs(int start, const CSRGraph<int>& graph) {
+    const size_t n = static_cast<size_t>(graph.num_vertices());
+    ParallelBFSResult<int> result;
+    result.level.assign(n, -1);
+    result.parent.assign(n, -1);
+
+    vector<int> queue = {start};
+    result.level[start] = 0;
+    for (size_t head = 0; head < queue.size(); head++) {
+        int u = queue[head];
+        for (int v : graph.neighbors(u)) {
+            if (result.level[v] == -1) {
+                result.level[v] = result.level[u] + 1;
+                result.parent[v] = u;
+                queue.push_back(v);
+            } else if (result.level[v] == result.level[u] + 1 && u < result.parent[v]) {
+                result.parent[v] = u;
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * Builds a random undirected graph with a skewed degree distribution
+ */
+CSRGraph<int> make_random_graph(int vertices, int edges_per_vertex, unsigned seed) {
+    mt19937 rng(seed);
+    uniform_real_distribution<double> unit(0.0, 1.0);
+    vector<pair<int, int>> edges;
+    edges.reserve(static_cast<size_t>(vertices) * edges_per_vertex * 2);
+    for (int u = 0; u < vertices; u++) {
+        for (int k = 0; k < edges_per_vertex; k++) {
+            double r = unit(rng);
+            int v = static_cast<int>(r * r * vertices);
+            if (v != u) {
+                edges.push_back({u, v});
+                edges.push_back({v, u});
+            }
+        }
+    }
+    return CSRGraph<int>::from_edge_list(vertices, edges);
+}
+
+/**
+ * Prints a vector
+ * @param arr: vector to print
+ */
+void print_vector(const vector<int>& arr) {
+    cout << "[";
+    for (size_t i = 0; i < arr.size(); i++) {
+        cout << arr[i];
+        if (i < arr.size() - 1) {
+            cout << ", ";
+        }
+    }
+    cout << "]" << endl;
+}
+
+// Example usage, test cases and thread scaling benchmark
+int main(int argc, char* argv[]) {
+    cout << "=== Parallel BFS Examples ===" << endl << endl;
+
+    ThreadPool pool(4);
+
+    // Test Case 1: Same undirected graph as in bfs.cpp
+    vector<vector<int>> adj = {{1, 2}, {0, 3, 4}, {0, 5}, {1}, {1}, {2}};
+    CSRGraph<int> small = CSRGraph<int>::from_adjacency_list(adj);
+    ParallelBFSResult<int> result1 = parallel_bfs(0, small, pool);
+    cout << "Test 1 - BFS starting from node 0:" << endl;
+    cout << "Levels:  ";
+    print_vector(result1.level);
+    cout << "Parents: ";
+    print_vector(result1.parent);
+    cout << endl;
+
+    // Test Case 2: Unreachable vertices
+    vector<pair<int, int>> edges2 = {{0, 1}, {1, 0}, {2, 3}, {3, 2}};
+    CSRGraph<int> split = CSRGraph<int>::from_edge_list(4, edges2);
+    ParallelBFSResult<int> result2 = parallel_bfs(0, split, pool);
+    cout << "Test 2 - Two components, BFS from node 0:" << endl;
+    cout << "Levels:  ";
+    print_vector(result2.level);
+    cout << "Parents: ";
+    print_vector(result2.parent);
+    cout << endl;
+
+    // Test Case 3: Random graph, compared with the serial version
+    CSRGraph<int> random_graph = make_random_graph(50000, 8, 7);
+    ParallelBFSResult<int> expected = serial_bfs(0, random_graph);
+    ParallelBFSResult<int> result3 = parallel_bfs(0, random_graph, pool);
+    cout << "Test 3 - Random graph (50000 vertices) vs serial BFS:" << endl;
+    cout << "Levels match: " << (result3.level == expected.level ? "yes" : "no") << endl;
+    cout << "Parents match: " << (result3.parent == expected.parent ? "yes" : "no") << endl;
+    cout << endl;
+
+    // Test Case 4: A CSRGraphView (e.g. a mapped graph file) works the same
+    ParallelBFSResult<int> result4 = parallel_bfs(0, random_graph.view(), pool);
+    cout << "Test 4 - CSRGraphView results match: "
+         << (result4.level == expected.level && result4.parent == expected.parent ? "yes" : "no") << endl;
+    cout << endl;
+
+    // Scaling benchmark: ./parallel_bfs [vertices] [max_threads]
+    int vertices = argc > 1 ? atoi(argv[1]) : 1000000;
+    unsigned max_threads = argc > 2 ? static_cast<unsigned>(atoi(argv[2]))
+                                    : max(1u, thread::hardware_concurrency());
+    const int kRepetitions = 3;
+
+    cout << "Scaling benchmark (" << vertices << " vertices, best of "
+         << kRepetitions << " runs):" << endl;
+    CSRGraph<int> bench_graph = make_random_graph(vertices, 8, 1);
+
+    vector<unsigned> thread_counts;
+    for (unsigned threads = 1; threads < max_threads; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    double single_thread_ms = 0;
+    for (unsigned threads : thread_counts) {
+        ThreadPool bench_pool(threads);
+        double best_ms = numeric_limits<double>::max();
+        for (int rep = 0; rep < kRepetitions; rep++) {
+            auto t0 = chrono::steady_clock::now();
+            parallel_bfs(0, bench_graph, bench_pool);
+            auto t1 = chrono::steady_clock::now();
+            best_ms = min(best_ms, chrono::duration<double, milli>(t1 - t0).count());
+        }
+        if (threads == 1) {
+            single_thread_ms = best_ms;
+        }
+        cout << "  threads=" << threads << "  time=" << best_ms << " ms"
+             << "  speedup=" << single_thread_ms / best_ms << "x" << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+/*
+ * Parallel Level-Synchronous Breadth First Search
+ *
+ * Description:
+ * BFS processes the graph one level (frontier) at a time, and all vertices
+ * of a frontier can be expanded independently. This version splits every
+ * frontier across a thread pool:
+ *
+ *   1. Expand: threads take chunks of the frontier and look at the
+ *      neighbors of each vertex. A neighbor that was not visited in an
+ *      earlier level is claimed with an atomic compare-and-swap on its
+ *      parent slot; the thread that claims it first appends it to its own
+ *      local next-frontier buffer (no shared queue, no locks).
+ *   2. Commit: the local buffers are concatenated into the next frontier and
+ *      the new vertices are marked in an atomic visited bitmap (one bit per
+ *      vertex instead of vector<bool>, safe to update from many threads).
+ *
+ * Determinism:
+ * Levels never depend on the thread schedule. Parents are made deterministic
+ * too: claiming uses an atomic minimum, so every vertex ends up with the
+ * smallest-id neighbor from the previous level as its parent, no matter
+ * which thread got there first. Results can therefore be compared exactly
+ * against a serial BFS.
+ *
+ * The graph is a CSRGraph or a CSRGraphView (e.g. a memory-mapped graph
+ * file, see graph_file.h). Parents follow the convention of bfs() and
+ * BFSWorkspace: -1 for the source and for unreachable vertices.
+ *
+ * Time Complexity: O(V + E) work, O(D) synchronization rounds
+ *   where D is the number of levels (graph diameter from the source)
+ * Space Complexity: O(V) for levels, parents, bitmap and frontiers
+ */
+
+#ifndef ALGOVAULT_GRAPH_PARALLEL_BFS_H
+#define ALGOVAULT_GRAPH_PARALLEL_BFS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "csr_graph.h"
+#include "../parallel/thread_pool.h"
+
+// Frontier chunk handed to one thread at a time
+const std::size_t kParallelBFSFrontierGrain = 256;
+
+// Chunk used for plain per-vertex loops (initialization, output copy)
+const std::size_t kParallelBFSVertexGrain = 1 << 16;
+
+/**
+ * Result of a parallel BFS run
+ * - level: BFS level of every vertex, -1 if unreachable
+ * - parent: smallest-id neighbor one level closer to the source,
+ *           -1 for the source and for unreachable vertices
+ */
+template <typename VertexId>
+struct ParallelBFSResult {
+    std::vector<VertexId> level;
+    std::vector<VertexId> parent;
+};
+
+/**
+ * Bitmap that can be updated from many threads at once
+ */
+class AtomicVertexBitmap {
+public:
+    explicit AtomicVertexBitmap(std::size_t size) : words_((size + 63) / 64) {
+        for (auto& word : words_) {
+            word.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    bool test(std::size_t i) const {
+        return (words_[i >> 6].load(std::memory_order_relaxed) >> (i & 63)) & 1;
+    }
+
+    void set(std::size_t i) {
+        words_[i >> 6].fetch_or(std::uint64_t{1} << (i & 63), std::memory_order_relaxed);
+    }
+
+private:
+    std::vector<std::atomic<std::uint64_t>> words_;
+};
+
+/**
+ * Performs level-synchronous BFS using all threads of a pool
+ *
+ * @param start: starting vertex for BFS
+ * @param graph: CSRGraph or CSRGraphView
+ * @param pool: thread pool that expands the frontiers
+ * @return levels and parents of all vertices
+ */
+template <typename Graph>
+ParallelBFSResult<GraphVertexId<Graph>> parallel_bfs(GraphVertexId<Graph> start, const Graph& graph,
+                                                     ThreadPool& pool) {
+    using VertexId = GraphVertexId<Graph>;
+    const std::size_t n = static_cast<std::size_t>(graph.num_vertices());
+    const VertexId kUnclaimed = std::numeric_limits<VertexId>::max();
+
+    AtomicVertexBitmap visited(n);
+    std::vector<std::atomic<VertexId>> parent(n);
+    ParallelBFSResult<VertexId> result;
+    result.level.assign(n, -1);
+
+    pool.parallel_for(0, n, kParallelBFSVertexGrain, [&](unsigned, std::size_t lo, std::size_t hi) {
+        for (std::size_t v = lo; v < hi; v++) {
+            parent[v].store(kUnclaimed, std::memory_order_relaxed);
+        }
+    });
+
+    // The source is visited from the start, so its slot is never claimed
+    visited.set(static_cast<std::size_t>(start));
+    result.level[start] = 0;
+
+    std::vector<VertexId> frontier = {start};
+    std::vector<VertexId> next;
+    std::vector<std::vector<VertexId>> local_next(pool.size());
+    VertexId depth = 0;
+
+    while (!frontier.empty()) {
+        // Expand: claim unvisited neighbors, keep the smallest parent id
+        pool.parallel_for(0, frontier.size(), kParallelBFSFrontierGrain,
+                          [&](unsigned thread, std::size_t lo, std::size_t hi) {
+            std::vector<VertexId>& out = local_next[thread];
+            for (std::size_t i = lo; i < hi; i++) {
+                const VertexId u = frontier[i];
+                for (VertexId v : graph.neighbors(u)) {
+                    // Visited bits only change between levels
+                    if (visited.test(static_cast<std::size_t>(v))) {
+                        continue;
+                    }
+                    VertexId current = parent[v].load(std::memory_order_relaxed);
+                    while (u < current &&
+                           !parent[v].compare_exchange_weak(current, u, std::memory_order_relaxed)) {
+                    }
+                    if (current == kUnclaimed) {
+                        out.push_back(v);
+                    }
+                }
+            }
+        });
+
+        // Commit: concatenate the thread-local buffers
+        std::vector<std::size_t> offsets(pool.size() + 1, 0);
+        for (unsigned t = 0; t < pool.size(); t++) {
+            offsets[t + 1] = offsets[t] + local_next[t].size();
+        }
+        next.resize(offsets.back());
+
+        pool.run_on_all([&](unsigned thread) {
+            std::vector<VertexId>& buffer = local_next[thread];
+            for (std::size_t i = 0; i < buffer.size(); i++) {
+                const VertexId v = buffer[i];
+                next[offsets[thread] + i] = v;
+                visited.set(static_cast<std::size_t>(v));
+                result.level[v] = depth + 1;
+            }
+            buffer.clear();
+        });
+
+        frontier.swap(next);
+        depth++;
+    }
+
+    result.parent.resize(n);
+    pool.parallel_for(0, n, kParallelBFSVertexGrain, [&](unsigned, std::size_t lo, std::size_t hi) {
+        for (std::size_t v = lo; v < hi; v++) {
+            VertexId p = parent[v].load(std::memory_order_relaxed);
+            result.parent[v] = (p == kUnclaimed) ? -1 : p;
+        }
+    });
+
+    return result;
+}
+
+#endif // ALGOVAULT_GRAPH_PARALLEL_BFS_H
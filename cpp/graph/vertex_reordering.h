@@ -0,0 +1,247 @@
+/*
+ * Vertex Reordering for traversal locality
+ *
+ * Description:
+ * Graph algorithms read the neighbor list of a vertex and then touch
+ * per-vertex data (visited stamps, levels, ...) of every neighbor. With
+ * arbitrary ids those neighbors are spread over the whole array and almost
+ * every access is a cache miss. Renumbering the vertices so that
+ * neighbors get nearby ids makes the same traversal much cheaper:
+ *
+ *   - kDegree: vertices sorted by decreasing degree. Hubs, which appear in
+ *     most neighbor lists, share a few cache lines.
+ *   - kBFS: ids in BFS order (one BFS per component). Vertices of the same
+ *     frontier, which are processed together, are adjacent.
+ *   - kReverseCuthillMcKee: BFS from a minimum degree vertex that visits
+ *     the neighbors of each vertex by increasing degree, then reversed.
+ *     Keeps the bandwidth max |new(u) - new(v)| over edges small, so most
+ *     neighbors of a vertex are close to it.
+ *
+ * The result is a VertexPermutation (new id of every old vertex and its
+ * inverse). reorder() builds the relabeled graph with sorted neighbor
+ * lists; results computed on it map back to the original ids through the
+ * permutation.
+ *
+ * Time Complexity: O(V + E) for kDegree and kBFS, O(V + E log d) for RCM
+ * Space Complexity: O(V + E) for the relabeled graph
+ */
+
+#ifndef ALGOVAULT_GRAPH_VERTEX_REORDERING_H
+#define ALGOVAULT_GRAPH_VERTEX_REORDERING_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "bfs_workspace.h"
+#include "csr_graph.h"
+
+/**
+ * Vertex numbering strategies
+ */
+enum class VertexOrdering { kDegree, kBFS, kReverseCuthillMcKee };
+
+/**
+ * Relabeling of the vertices of a graph
+ * - new_id[old] = id of the old vertex in the reordered graph
+ * - old_id[new] = inverse of new_id
+ */
+template <typename VertexId>
+struct VertexPermutation {
+    std::vector<VertexId> new_id;
+    std::vector<VertexId> old_id;
+
+    /**
+     * Builds the permutation from the list of old ids in their new order
+     */
+    static VertexPermutation from_order(std::vector<VertexId> order) {
+        VertexPermutation permutation;
+        permutation.new_id.resize(order.size());
+        for (std::size_t i = 0; i < order.size(); i++) {
+            permutation.new_id[order[i]] = static_cast<VertexId>(i);
+        }
+        permutation.old_id = std::move(order);
+        return permutation;
+    }
+
+    /**
+     * Per-vertex values of the reordered graph indexed by original id
+     * (levels, component ids, ...)
+     */
+    template <typename T>
+    std::vector<T> values_to_original(const std::vector<T>& by_new_id) const {
+        std::vector<T> by_old_id(by_new_id.size());
+        for (std::size_t v = 0; v < by_new_id.size(); v++) {
+            by_old_id[old_id[v]] = by_new_id[v];
+        }
+        return by_old_id;
+    }
+
+    /**
+     * Vertex ids of the reordered graph translated to original ids
+     * (traversal orders, paths, parents; negative ids stay as they are)
+     */
+    std::vector<VertexId> ids_to_original(const std::vector<VertexId>& ids) const {
+        std::vector<VertexId> original(ids.size());
+        for (std::size_t i = 0; i < ids.size(); i++) {
+            original[i] = ids[i] < 0 ? ids[i] : old_id[ids[i]];
+        }
+        return original;
+    }
+};
+
+/**
+ * Vertices by decreasing degree; equal degrees keep their id order
+ * (counting sort on the degree)
+ */
+template <typename VertexId>
+std::vector<VertexId> degree_order(const CSRGraph<VertexId>& graph) {
+    const std::size_t n = static_cast<std::size_t>(graph.num_vertices());
+    std::size_t max_degree = 0;
+    for (VertexId v = 0; v < graph.num_vertices(); v++) {
+        max_degree = std::max<std::size_t>(max_degree, graph.degree(v));
+    }
+
+    // start[d] = first position of degree d, highest degree first
+    std::vector<std::size_t> start(max_degree + 2, 0);
+    for (VertexId v = 0; v < graph.num_vertices(); v++) {
+        start[max_degree - graph.degree(v) + 1]++;
+    }
+    for (std::size_t d = 1; d < start.size(); d++) {
+        start[d] += start[d - 1];
+    }
+    std::vector<VertexId> order(n);
+    for (VertexId v = 0; v < graph.num_vertices(); v++) {
+        order[start[max_degree - graph.degree(v)]++] = v;
+    }
+    return order;
+}
+
+/**
+ * Vertices in BFS order, one BFS per unvisited vertex in id order
+ */
+template <typename VertexId>
+std::vector<VertexId> bfs_order(const CSRGraph<VertexId>& graph) {
+    BFSWorkspace<VertexId> workspace(graph.num_vertices());
+    std::vector<VertexId> order;
+    order.reserve(static_cast<std::size_t>(graph.num_vertices()));
+
+    // One epoch for all roots: vertices stay visited across components
+    workspace.reset();
+    for (VertexId root = 0; root < graph.num_vertices(); root++) {
+        if (!workspace.visit(root)) {
+            continue;
+        }
+        order.push_back(root);
+        for (std::size_t head = order.size() - 1; head < order.size(); head++) {
+            for (VertexId neighbor : graph.neighbors(order[head])) {
+                if (workspace.visit(neighbor)) {
+                    order.push_back(neighbor);
+                }
+            }
+        }
+    }
+    return order;
+}
+
+/**
+ * Vertices in Reverse Cuthill-McKee order
+ *
+ * Each component starts at its unvisited vertex of minimum degree, and
+ * the newly found neighbors of every vertex are queued by increasing
+ * degree. The final order is reversed.
+ */
+template <typename VertexId>
+std::vector<VertexId> reverse_cuthill_mckee_order(const CSRGraph<VertexId>& graph) {
+    BFSWorkspace<VertexId> workspace(graph.num_vertices());
+    std::vector<VertexId> order;
+    order.reserve(static_cast<std::size_t>(graph.num_vertices()));
+    auto by_degree = [&graph](VertexId a, VertexId b) {
+        return graph.degree(a) < graph.degree(b) || (graph.degree(a) == graph.degree(b) && a < b);
+    };
+
+    // Candidate roots: all vertices by increasing degree
+    std::vector<VertexId> roots = degree_order(graph);
+    std::reverse(roots.begin(), roots.end());
+
+    workspace.reset();
+    for (VertexId root : roots) {
+        if (!workspace.visit(root)) {
+            continue;
+        }
+        order.push_back(root);
+        for (std::size_t head = order.size() - 1; head < order.size(); head++) {
+            const std::size_t first_new = order.size();
+            for (VertexId neighbor : graph.neighbors(order[head])) {
+                if (workspace.visit(neighbor)) {
+                    order.push_back(neighbor);
+                }
+            }
+            std::sort(order.begin() + static_cast<std::ptrdiff_t>(first_new), order.end(),
+                      by_degree);
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+/**
+ * Computes a vertex permutation
+ * @param graph: graph to renumber
+ * @param ordering: numbering strategy
+ */
+template <typename VertexId>
+VertexPermutation<VertexId> compute_vertex_ordering(const CSRGraph<VertexId>& graph,
+                                                    VertexOrdering ordering) {
+    switch (ordering) {
+        case VertexOrdering::kDegree:
+            return VertexPermutation<VertexId>::from_order(degree_order(graph));
+        case VertexOrdering::kBFS:
+            return VertexPermutation<VertexId>::from_order(bfs_order(graph));
+        default:
+            return VertexPermutation<VertexId>::from_order(reverse_cuthill_mckee_order(graph));
+    }
+}
+
+/**
+ * Builds the graph with every vertex v renamed to permutation.new_id[v];
+ * neighbor lists are sorted by new id
+ */
+template <typename VertexId>
+CSRGraph<VertexId> reorder(const CSRGraph<VertexId>& graph,
+                           const VertexPermutation<VertexId>& permutation) {
+    using edge_index = typename CSRGraph<VertexId>::edge_index;
+    const std::size_t n = static_cast<std::size_t>(graph.num_vertices());
+    std::vector<edge_index> offsets(n + 1, 0);
+    for (std::size_t v = 0; v < n; v++) {
+        offsets[v + 1] = offsets[v] + graph.degree(permutation.old_id[v]);
+    }
+
+    std::vector<VertexId> neighbors(static_cast<std::size_t>(graph.num_edges()));
+    for (std::size_t v = 0; v < n; v++) {
+        VertexId* out = neighbors.data() + offsets[v];
+        VertexId* end = out;
+        for (VertexId u : graph.neighbors(permutation.old_id[v])) {
+            *end++ = permutation.new_id[u];
+        }
+        std::sort(out, end);
+    }
+    return CSRGraph<VertexId>(std::move(offsets), std::move(neighbors));
+}
+
+/**
+ * Bandwidth of a graph: max |u - v| over all edges u -> v
+ */
+template <typename VertexId>
+std::size_t graph_bandwidth(const CSRGraph<VertexId>& graph) {
+    std::size_t bandwidth = 0;
+    for (VertexId u = 0; u < graph.num_vertices(); u++) {
+        for (VertexId v : graph.neighbors(u)) {
+            bandwidth = std::max<std::size_t>(bandwidth, static_cast<std::size_t>(u > v ? u - v : v - u));
+        }
+    }
+    return bandwidth;
+}
+
+#endif // ALGOVAULT_GRAPH_VERTEX_REORDERING_H
@@ -0,0 +1,82 @@
+/*
+ * Thread Pool Examples
+ *
+ * Description:
+ * ThreadPool (see thread_pool.h) runs data-parallel loops on a fixed set of
+ * threads, with the calling thread as worker 0. parallel_for() hands out
+ * chunks of an index range through one atomic counter; an exception thrown
+ * by the loop body is rethrown on the caller after every thread stopped.
+ *
+ * Time Complexity: O(n / threads) per parallel_for plus one barrier
+ * Space Complexity: O(threads)
+ */
+
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include "thread_pool.h"
+using namespace std;
+
+/**
+ * Sums values with parallel_for, one partial sum per thread
+ */
+uint64_t parallel_sum(const vector<uint32_t>& values, ThreadPool& pool) {
+    vector<uint64_t> partial(pool.size(), 0);
+    pool.parallel_for(0, values.size(), 1000, [&](unsigned thread, size_t lo, size_t hi) {
+        for (size_t i = lo; i < hi; i++) {
+            partial[thread] += values[i];
+        }
+    });
+    return accumulate(partial.begin(), partial.end(), uint64_t{0});
+}
+
+/**
+ * Runs a loop whose body throws on the chunk starting at throw_at
+ * @return message of the exception the caller received, empty if none
+ */
+string throwing_loop(ThreadPool& pool, size_t throw_at) {
+    try {
+        pool.parallel_for(0, 100000, 100, [&](unsigned, size_t lo, size_t) {
+            if (lo == throw_at) {
+                throw runtime_error("chunk " + to_string(lo) + " failed");
+            }
+        });
+    } catch (const runtime_error& error) {
+        return error.what();
+    }
+    return "";
+}
+
+// Example usage and test cases
+int main() {
+    cout << "=== Thread Pool Examples ===" << endl << endl;
+
+    ThreadPool pool(4);
+    cout << "Threads: " << pool.size() << endl << endl;
+
+    // Test Case 1: Parallel sum
+    vector<uint32_t> values(1000000);
+    iota(values.begin(), values.end(), 1u);
+    uint64_t sum = parallel_sum(values, pool);
+    cout << "Test 1 - Sum of 1 .. 1000000: " << sum << endl;
+    cout << "Sum correct: " << (sum == 500000500000ull ? "yes" : "no") << endl << endl;
+
+    // Test Case 2: A throwing body, early and late in the range; whichever
+    // thread runs the chunk, the caller gets the exception
+    cout << "Test 2 - Loop body throws:" << endl;
+    bool caught_ok = true;
+    for (size_t throw_at : {size_t{0}, size_t{50000}, size_t{99900}}) {
+        string message = throwing_loop(pool, throw_at);
+        cout << "  caught: \"" << message << "\"" << endl;
+        caught_ok = caught_ok && message == "chunk " + to_string(throw_at) + " failed";
+    }
+    cout << "Exception rethrown on the caller correct: " << (caught_ok ? "yes" : "no") << endl << endl;
+
+    // Test Case 3: The pool keeps working after an exception
+    uint64_t sum_after = parallel_sum(values, pool);
+    cout << "Test 3 - Sum after the exceptions correct: " << (sum_after == sum ? "yes" : "no") << endl;
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+/*
+ * Fork-Join Thread Pool
+ *
+ * Description:
+ * A fixed set of worker threads that run data-parallel loops. The calling
+ * thread always takes part as worker 0, so a pool of N threads starts only
+ * N - 1 extra threads, and a pool of size 1 runs everything inline.
+ *
+ * parallel_for() hands out chunks of an index range through one shared
+ * atomic counter, so threads that finish early simply grab more chunks
+ * (dynamic load balancing without per-task allocations). This fits
+ * level-synchronous algorithms well: every level is one parallel_for, and
+ * returning from it is the barrier between levels.
+ *
+ * An exception thrown by a task, on any thread, is rethrown on the caller
+ * once every thread has left the task (the task may use the caller's stack
+ * until then). When several threads throw, one exception is rethrown and
+ * the others are dropped.
+ *
+ * Usage:
+ *     ThreadPool pool(8);
+ *     pool.parallel_for(0, n, 1024, [&](unsigned thread, size_t lo, size_t hi) {
+ *         for (size_t i = lo; i < hi; i++) { ... }
+ *     });
+ */
+
+#ifndef ALGOVAULT_PARALLEL_THREAD_POOL_H
+#define ALGOVAULT_PARALLEL_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+public:
+    /**
+     * Starts the worker threads
+     * @param num_threads: total threads including the caller, 0 = all cores
+     */
+    explicit ThreadPool(unsigned num_threads = 0) {
+        if (num_threads == 0) {
+            num_threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        for (unsigned id = 1; id < num_threads; id++) {
+            workers_.emplace_back([this, id] { worker_loop(id); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @return total number of threads, including the caller
+     */
+    unsigned size() const { return static_cast<unsigned>(workers_.size()) + 1; }
+
+    /**
+     * Runs task(thread_index) once on every thread and waits for all of them
+     * @param task: function called with thread indices 0 .. size() - 1
+     * @throws the first exception thrown by task, after all threads finished
+     */
+    void run_on_all(const std::function<void(unsigned)>& task) {
+        if (workers_.empty()) {
+            task(0);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            pending_ = static_cast<unsigned>(workers_.size());
+            generation_++;
+        }
+        wake_.notify_all();
+
+        std::exception_ptr error;
+        try {
+            task(0);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return pending_ == 0; });
+        task_ = nullptr;
+        if (!error) {
+            error = error_;
+        }
+        error_ = nullptr;
+        if (error) {
+            lock.unlock();
+            std::rethrow_exception(error);
+        }
+    }
+
+    /**
+     * Runs body over [begin, end) split into chunks of at most grain indices
+     *
+     * Ranges that fit in one chunk run inline on the caller without waking
+     * the workers.
+     *
+     * @param begin: first index
+     * @param end: one past the last index
+     * @param grain: chunk size handed to a thread at a time
+     * @param body: called as body(thread_index, chunk_begin, chunk_end)
+     */
+    template <typename Body>
+    void parallel_for(std::size_t begin, std::size_t end, std::size_t grain, Body&& body) {
+        if (begin >= end) {
+            return;
+        }
+        grain = std::max<std::size_t>(grain, 1);
+        if (end - begin <= grain || workers_.empty()) {
+            body(0u, begin, end);
+            return;
+        }
+
+        std::atomic<std::size_t> next(begin);
+        run_on_all([&](unsigned thread) {
+            while (true) {
+                std::size_t lo = next.fetch_add(grain, std::memory_order_relaxed);
+                if (lo >= end) {
+                    break;
+                }
+                body(thread, lo, std::min(end, lo + grain));
+            }
+        });
+    }
+
+private:
+    void worker_loop(unsigned id) {
+        unsigned long long seen = 0;
+        while (true) {
+            const std::function<void(unsigned)>* task = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+                if (stopping_) {
+                    return;
+                }
+                seen = generation_;
+                task = task_;
+            }
+
+            std::exception_ptr error;
+            try {
+                (*task)(id);
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (error && !error_) {
+                error_ = error;
+            }
+            if (--pending_ == 0) {
+                done_.notify_one();
+            }
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const std::function<void(unsigned)>* task_ = nullptr;
+    std::exception_ptr error_;  // first exception thrown by a worker
+    unsigned long long generation_ = 0;
+    unsigned pending_ = 0;
+    bool stopping_ = false;
+};
+
+#endif // ALGOVAULT_PARALLEL_THREAD_POOL_H
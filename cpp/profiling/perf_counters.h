@@ -0,0 +1,310 @@
+/*
+ * Performance Counter Instrumentation
+ *
+ * Description:
+ * Opt-in measurement of algorithm hot loops with Linux perf_event_open.
+ * A region is a named piece of code such as "topological_sort/indegree";
+ * every time it runs, its wall time and the counters of the running thread
+ * are added to the totals of the region:
+ *   cycles, instructions (IPC = instructions / cycles), last level cache
+ *   misses, branch misses, page faults
+ *
+ * Compile with -DALGOVAULT_PERF to enable, for the whole program (inline
+ * functions must be the same in every file). Without it the macros expand
+ * to nothing and the algorithms compile exactly as before.
+ *
+ *     void algorithm() {
+ *         ALGOVAULT_PERF_SCOPE("algorithm/first_pass");   // until the end of the block
+ *         ...
+ *         ALGOVAULT_PERF_NEXT("algorithm/second_pass");   // ends the previous phase
+ *         ...
+ *     }
+ *     ...
+ *     perf_report(std::cout);
+ *
+ * Counters the kernel refuses (no PMU in a virtual machine, too strict
+ * /proc/sys/kernel/perf_event_paranoid) are shown as n/a; wall time is
+ * always measured. Entering and leaving a region costs a few system calls,
+ * so regions cover whole loops, never single iterations. Nested regions
+ * count inclusively.
+ *
+ * Time Complexity: O(1) system calls per region entry and exit
+ * Space Complexity: O(regions)
+ */
+
+#ifndef ALGOVAULT_PROFILING_PERF_COUNTERS_H
+#define ALGOVAULT_PROFILING_PERF_COUNTERS_H
+
+#ifdef ALGOVAULT_PERF
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+const std::size_t kPerfEvents = 5;
+
+using PerfValues = std::array<std::uint64_t, kPerfEvents>;
+
+inline const char* perf_event_name(std::size_t event) {
+    static const char* const kNames[kPerfEvents] = {"cycles", "instructions", "llc_misses",
+                                                    "branch_misses", "page_faults"};
+    return kNames[event];
+}
+
+/**
+ * Counter file descriptors of one thread (perf counts only the thread
+ * that opened them)
+ */
+class PerfCounters {
+public:
+    PerfCounters() {
+        fds_.fill(-1);
+#ifdef __linux__
+        const std::uint32_t types[kPerfEvents] = {PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+                                                  PERF_TYPE_HARDWARE, PERF_TYPE_SOFTWARE};
+        const std::uint64_t configs[kPerfEvents] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                    PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES,
+                                                    PERF_COUNT_SW_PAGE_FAULTS};
+        for (std::size_t event = 0; event < kPerfEvents; event++) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = types[event];
+            attr.config = configs[event];
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            // More events than hardware counters are time-multiplexed;
+            // these two times let read() scale the counts back up
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            fds_[event] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+            if (fds_[event] < 0 && error_.empty()) {
+                error_ = std::string(perf_event_name(event)) + ": " + std::strerror(errno);
+            }
+        }
+#else
+        error_ = "perf_event_open needs Linux";
+#endif
+    }
+
+    ~PerfCounters() {
+#ifdef __linux__
+        for (int fd : fds_) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /**
+     * Counters of the calling thread, opened on first use
+     */
+    static PerfCounters& for_this_thread() {
+        thread_local PerfCounters counters;
+        return counters;
+    }
+
+    bool available(std::size_t event) const { return fds_[event] >= 0; }
+
+    /**
+     * @return why the first unavailable counter could not be opened, empty
+     *         if all are available
+     */
+    const std::string& error() const { return error_; }
+
+    /**
+     * Current counts since the counters were opened (0 if unavailable)
+     */
+    PerfValues read() const {
+        PerfValues values{};
+#ifdef __linux__
+        for (std::size_t event = 0; event < kPerfEvents; event++) {
+            std::uint64_t data[3];  // value, time enabled, time running
+            if (fds_[event] < 0 || ::read(fds_[event], data, sizeof(data)) != sizeof(data)) {
+                continue;
+            }
+            values[event] = data[2] == 0 || data[1] == data[2]
+                                ? data[0]
+                                : static_cast<std::uint64_t>(static_cast<long double>(data[0]) * data[1] / data[2]);
+        }
+#endif
+        return values;
+    }
+
+private:
+    std::array<int, kPerfEvents> fds_;
+    std::string error_;
+};
+
+/**
+ * Totals of one named region over all threads
+ */
+struct PerfRegion {
+    explicit PerfRegion(const char* region_name) : name(region_name) {}
+
+    std::string name;
+    std::atomic<std::uint64_t> calls{0};
+    std::atomic<std::uint64_t> wall_ns{0};
+    std::array<std::atomic<std::uint64_t>, kPerfEvents> counts{};
+};
+
+inline std::mutex& perf_registry_mutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+/**
+ * All regions; a deque keeps references valid as regions are added
+ */
+inline std::deque<PerfRegion>& perf_registry() {
+    static std::deque<PerfRegion> regions;
+    return regions;
+}
+
+/**
+ * The region with this name, created on first use
+ */
+inline PerfRegion& perf_region(const char* name) {
+    std::lock_guard<std::mutex> lock(perf_registry_mutex());
+    for (PerfRegion& region : perf_registry()) {
+        if (region.name == name) {
+            return region;
+        }
+    }
+    return perf_registry().emplace_back(name);
+}
+
+/**
+ * Measures from construction (or next()) to destruction (or the next next())
+ */
+class PerfScope {
+public:
+    explicit PerfScope(PerfRegion& region) : counters_(PerfCounters::for_this_thread()) { start(region); }
+
+    ~PerfScope() { stop(); }
+
+    PerfScope(const PerfScope&) = delete;
+    PerfScope& operator=(const PerfScope&) = delete;
+
+    /**
+     * Ends the current phase and starts measuring the next one
+     */
+    void next(PerfRegion& region) {
+        stop();
+        start(region);
+    }
+
+private:
+    void start(PerfRegion& region) {
+        region_ = &region;
+        wall_start_ = std::chrono::steady_clock::now();
+        start_ = counters_.read();
+    }
+
+    void stop() {
+        const PerfValues end = counters_.read();
+        const auto wall_end = std::chrono::steady_clock::now();
+        region_->calls.fetch_add(1, std::memory_order_relaxed);
+        region_->wall_ns.fetch_add(
+            static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(wall_end - wall_start_).count()),
+            std::memory_order_relaxed);
+        for (std::size_t event = 0; event < kPerfEvents; event++) {
+            region_->counts[event].fetch_add(end[event] - start_[event], std::memory_order_relaxed);
+        }
+    }
+
+    PerfCounters& counters_;
+    PerfRegion* region_ = nullptr;
+    std::chrono::steady_clock::time_point wall_start_;
+    PerfValues start_{};
+};
+
+/**
+ * Clears the totals of every region
+ */
+inline void perf_reset() {
+    std::lock_guard<std::mutex> lock(perf_registry_mutex());
+    for (PerfRegion& region : perf_registry()) {
+        region.calls = 0;
+        region.wall_ns = 0;
+        for (auto& count : region.counts) {
+            count = 0;
+        }
+    }
+}
+
+/**
+ * Prints one line per region that ran: calls, wall time and counters
+ * (n/a for counters this machine does not provide)
+ */
+inline void perf_report(std::ostream& out) {
+    const PerfCounters& counters = PerfCounters::for_this_thread();
+    char line[256];
+    std::snprintf(line, sizeof(line), "%-32s %8s %11s %14s %14s %6s %12s %12s %11s\n", "region", "calls",
+                  "wall_ms", "cycles", "instructions", "IPC", "llc_misses", "branch_miss", "page_faults");
+    out << line;
+
+    std::lock_guard<std::mutex> lock(perf_registry_mutex());
+    for (const PerfRegion& region : perf_registry()) {
+        if (region.calls == 0) {
+            continue;
+        }
+        std::string cells[kPerfEvents];
+        for (std::size_t event = 0; event < kPerfEvents; event++) {
+            cells[event] = counters.available(event) ? std::to_string(region.counts[event].load()) : "n/a";
+        }
+        char ipc[16] = "n/a";
+        if (counters.available(0) && counters.available(1) && region.counts[0] > 0) {
+            std::snprintf(ipc, sizeof(ipc), "%.2f",
+                          static_cast<double>(region.counts[1]) / static_cast<double>(region.counts[0]));
+        }
+        std::snprintf(line, sizeof(line), "%-32s %8llu %11.3f %14s %14s %6s %12s %12s %11s\n",
+                      region.name.c_str(), static_cast<unsigned long long>(region.calls.load()),
+                      static_cast<double>(region.wall_ns) / 1e6, cells[0].c_str(), cells[1].c_str(), ipc,
+                      cells[2].c_str(), cells[3].c_str(), cells[4].c_str());
+        out << line;
+    }
+    if (!counters.error().empty()) {
+        out << "(counter unavailable: " << counters.error() << ")\n";
+    }
+}
+
+#define ALGOVAULT_PERF_CONCAT_(a, b) a##b
+#define ALGOVAULT_PERF_CONCAT(a, b) ALGOVAULT_PERF_CONCAT_(a, b)
+#define ALGOVAULT_PERF_REGION_ ALGOVAULT_PERF_CONCAT(algovault_perf_region_, __LINE__)
+
+// The region is looked up once per call site (function-local static)
+#define ALGOVAULT_PERF_SCOPE(name)                                 \
+    static PerfRegion& ALGOVAULT_PERF_REGION_ = perf_region(name); \
+    PerfScope algovault_perf_scope_(ALGOVAULT_PERF_REGION_)
+
+#define ALGOVAULT_PERF_NEXT(name)                                  \
+    static PerfRegion& ALGOVAULT_PERF_REGION_ = perf_region(name); \
+    algovault_perf_scope_.next(ALGOVAULT_PERF_REGION_)
+
+#else
+
+#define ALGOVAULT_PERF_SCOPE(name) static_cast<void>(0)
+#define ALGOVAULT_PERF_NEXT(name) static_cast<void>(0)
+
+#endif // ALGOVAULT_PERF
+
+#endif // ALGOVAULT_PROFILING_PERF_COUNTERS_H
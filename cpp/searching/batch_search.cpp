@@ -0,0 +1,119 @@
+/*
+ * Batched Multi-Target Search Examples
+ *
+ * Description:
+ * batch_search() (see batch_search.h) finds the first index of many targets
+ * in the same unsorted array. It picks one SIMD scan per target for small
+ * batches, a hash table of the targets plus one pass over the array for
+ * medium batches, and a hash index of the array when there are more
+ * targets than elements. Results match linear_search() for every target.
+ *
+ * Time Complexity: O(k * n) for small batches, O(n + k) otherwise
+ * Space Complexity: O(k) for the target table, O(n) for the array index
+ */
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "batch_search.h"
+#include "simd_linear_search.h"
+using namespace std;
+
+/**
+ * Prints a vector
+ * @param arr: vector to print
+ */
+void print_vector(const vector<int>& arr) {
+    cout << "[";
+    for (size_t i = 0; i < arr.size(); i++) {
+        cout << arr[i];
+        if (i < arr.size() - 1) {
+            cout << ", ";
+        }
+    }
+    cout << "]" << endl;
+}
+
+// Example usage and test cases
+int main() {
+    cout << "=== Batch Search Examples ===" << endl << endl;
+
+    // Test Case 1: A few targets, some missing, one duplicate value
+    vector<int> arr1 = {10, 23, 45, 70, 11, 15, 70};
+    vector<int> targets1 = {70, 100, 10, 15};
+    cout << "Test 1 - Small batch:" << endl;
+    cout << "Array: ";
+    print_vector(arr1);
+    cout << "Targets: ";
+    print_vector(targets1);
+    cout << "Strategy: "
+         << batch_strategy_name(choose_batch_strategy(arr1.size(), targets1.size())) << endl;
+    cout << "Indices: ";
+    print_vector(batch_search(arr1, targets1));
+    cout << endl;
+
+    // Test Case 2: Empty array and empty batch
+    cout << "Test 2 - Empty inputs:" << endl;
+    cout << "Empty array: ";
+    print_vector(batch_search(vector<int>{}, vector<int>{1, 2, 3}));
+    cout << "Empty batch: ";
+    print_vector(batch_search(arr1, vector<int>{}));
+    cout << endl;
+
+    // Test Case 3: All strategies agree on random data
+    mt19937 rng(11);
+    uniform_int_distribution<int> value(0, 5000);
+    vector<int> arr3(20000);
+    for (int& x : arr3) {
+        x = value(rng);
+    }
+    vector<int> targets3(3000);
+    for (int& x : targets3) {
+        x = value(rng) + 1000;  // some targets are not in the array
+    }
+    vector<int> expected3(targets3.size());
+    for (size_t t = 0; t < targets3.size(); t++) {
+        expected3[t] = static_cast<int>(
+            linear_search_scalar(arr3.data(), arr3.size(), targets3[t]));
+    }
+    bool all_match = true;
+    for (BatchStrategy strategy : {BatchStrategy::kScanPerTarget, BatchStrategy::kTargetTable,
+                                   BatchStrategy::kArrayIndex}) {
+        vector<int> got = batch_search(arr3.data(), arr3.size(), targets3.data(),
+                                       targets3.size(), strategy);
+        all_match = all_match && got == expected3;
+    }
+    cout << "Test 3 - All strategies vs linear_search per target:" << endl;
+    cout << "Results match: " << (all_match ? "yes" : "no") << endl << endl;
+
+    // Test Case 4: Timing for growing batches on a 1M element array
+    const size_t kSize = 1000000;
+    vector<int> big(kSize);
+    for (int& x : big) {
+        x = static_cast<int>(rng() & 0x7FFFFFFF);
+    }
+    cout << "Test 4 - Batches on " << kSize << " elements:" << endl;
+    for (size_t batch : {size_t{4}, size_t{64}, size_t{4096}, size_t{2000000}}) {
+        vector<int> targets(batch);
+        for (size_t t = 0; t < batch; t++) {
+            // Half present (taken from the array), half most likely absent
+            targets[t] = (t % 2 == 0) ? big[rng() % kSize] : static_cast<int>(rng() | 0x80000000u);
+        }
+
+        auto t0 = chrono::steady_clock::now();
+        vector<int> result = batch_search(big, targets);
+        auto t1 = chrono::steady_clock::now();
+
+        size_t found = 0;
+        for (int index : result) {
+            found += index >= 0;
+        }
+        cout << "  batch=" << batch << "  strategy="
+             << batch_strategy_name(choose_batch_strategy(kSize, batch))
+             << "  found=" << found << "  time="
+             << chrono::duration<double, milli>(t1 - t0).count() << " ms" << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,225 @@
+/*
+ * Batched Multi-Target Search
+ *
+ * Description:
+ * Finds the first index of MANY targets in the same unsorted array.
+ * Calling linear_search() once per target costs one full pass per target
+ * (k * n compares for k targets). The batch search picks one of three
+ * strategies from the batch size k and the array size n:
+ *
+ *   1. Scan per target (small k): one SIMD linear search per target. Each
+ *      pass stops at the first match, and while k is below a few times the
+ *      SIMD width this is cheaper than a hash lookup per element.
+ *   2. Target table + one pass (k <= n): the distinct targets go into a
+ *      small open-addressing hash table, then the array is scanned once
+ *      and every element is looked up in that (cache resident) table.
+ *      The scan stops as soon as every target has been found.
+ *   3. Array index (k > n): the array is turned into a table that maps
+ *      each value to its first index, then every target is one lookup.
+ *
+ * Every strategy returns exactly what linear_search() would return for
+ * each target: the index of the first match, or -1.
+ *
+ * Time Complexity:
+ *   Scan per target: O(k * n)
+ *   Target table:    O(n + k)
+ *   Array index:     O(n + k)
+ * Space Complexity: O(k) for the target table, O(n) for the array index
+ */
+
+#ifndef ALGOVAULT_SEARCHING_BATCH_SEARCH_H
+#define ALGOVAULT_SEARCHING_BATCH_SEARCH_H
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "simd_linear_search.h"
+
+// One hash probe costs about as much as this many vector compares,
+// so separate scans win while k < kBatchProbeCost * ints per compare
+const std::size_t kBatchProbeCost = 2;
+
+/**
+ * How a batch of targets is searched
+ */
+enum class BatchStrategy { kScanPerTarget, kTargetTable, kArrayIndex };
+
+/**
+ * Open addressing hash table from int keys to int values
+ * (linear probing, power of two capacity, at most half full)
+ *
+ * Empty slots hold the key INT_MIN, so a probe is a single compare per
+ * slot; the key INT_MIN itself is stored outside the table.
+ */
+class IntHashMap {
+public:
+    explicit IntHashMap(std::size_t expected_size) {
+        std::size_t capacity = 16;
+        shift_ = 60;
+        while (capacity < 2 * expected_size) {
+            capacity *= 2;
+            shift_--;
+        }
+        slots_.assign(capacity, Slot{kEmpty, 0});
+    }
+
+    /**
+     * Inserts key with value if the key is not present yet
+     */
+    void insert(int key, int value) {
+        if (key == kEmpty) {
+            if (!has_empty_key_) {
+                has_empty_key_ = true;
+                empty_key_value_ = value;
+            }
+            return;
+        }
+        Slot& slot = slots_[find_slot(key)];
+        if (slot.key == kEmpty) {
+            slot.key = key;
+            slot.value = value;
+        }
+    }
+
+    /**
+     * @return pointer to the value stored for key, nullptr if absent
+     */
+    int* find(int key) {
+        if (key == kEmpty) {
+            return has_empty_key_ ? &empty_key_value_ : nullptr;
+        }
+        Slot& slot = slots_[find_slot(key)];
+        return slot.key == key ? &slot.value : nullptr;
+    }
+
+private:
+    struct Slot {
+        int key;
+        int value;
+    };
+
+    static const int kEmpty = INT_MIN;
+
+    std::size_t find_slot(int key) const {
+        // Fibonacci hashing: the high bits of the product are well mixed
+        std::size_t slot = static_cast<std::size_t>(
+            (static_cast<std::uint64_t>(static_cast<std::uint32_t>(key)) * 0x9E3779B97F4A7C15ull) >> shift_);
+        const std::size_t mask = slots_.size() - 1;
+        while (slots_[slot].key != key && slots_[slot].key != kEmpty) {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    std::vector<Slot> slots_;
+    int shift_;
+    bool has_empty_key_ = false;
+    int empty_key_value_ = 0;
+};
+
+/**
+ * Chooses the cheapest strategy for a batch
+ * @param array_size: number of elements searched
+ * @param batch_size: number of targets
+ */
+inline BatchStrategy choose_batch_strategy(std::size_t array_size, std::size_t batch_size) {
+    static const SimdLevel level = detect_simd_level();
+    const std::size_t ints_per_compare = level == SimdLevel::kAVX512 ? 16
+                                  : level == SimdLevel::kAVX2   ? 8
+                                  : level == SimdLevel::kSSE2   ? 4
+                                  : 1;
+    if (batch_size <= kBatchProbeCost * ints_per_compare) {
+        return BatchStrategy::kScanPerTarget;
+    }
+    if (batch_size <= array_size) {
+        return BatchStrategy::kTargetTable;
+    }
+    return BatchStrategy::kArrayIndex;
+}
+
+/**
+ * @return printable name of a strategy
+ */
+inline const char* batch_strategy_name(BatchStrategy strategy) {
+    switch (strategy) {
+        case BatchStrategy::kScanPerTarget: return "scan per target";
+        case BatchStrategy::kTargetTable: return "target table + one pass";
+        default: return "array index";
+    }
+}
+
+/**
+ * Searches many targets in one array with a given strategy
+ *
+ * @param arr: array to search in
+ * @param size: number of elements in arr
+ * @param targets: targets to look for
+ * @param count: number of targets
+ * @param strategy: how to search
+ * @return result[i] = first index of targets[i] in arr, -1 if absent
+ */
+inline std::vector<int> batch_search(const int* arr, std::size_t size, const int* targets, std::size_t count,
+                                     BatchStrategy strategy) {
+    std::vector<int> result(count, -1);
+
+    if (strategy == BatchStrategy::kScanPerTarget) {
+        for (std::size_t t = 0; t < count; t++) {
+            result[t] = static_cast<int>(linear_search_simd(arr, size, targets[t]));
+        }
+        return result;
+    }
+
+    if (strategy == BatchStrategy::kTargetTable) {
+        IntHashMap first_index(count);
+        std::size_t distinct = 0;
+        for (std::size_t t = 0; t < count; t++) {
+            if (first_index.find(targets[t]) == nullptr) {
+                first_index.insert(targets[t], -1);
+                distinct++;
+            }
+        }
+
+        // One pass over the array, stop once every target was seen
+        std::size_t remaining = distinct;
+        for (std::size_t i = 0; i < size && remaining > 0; i++) {
+            int* slot = first_index.find(arr[i]);
+            if (slot != nullptr && *slot == -1) {
+                *slot = static_cast<int>(i);
+                remaining--;
+            }
+        }
+
+        for (std::size_t t = 0; t < count; t++) {
+            result[t] = *first_index.find(targets[t]);
+        }
+        return result;
+    }
+
+    // Array index: first occurrence of every value wins
+    IntHashMap index(size);
+    for (std::size_t i = 0; i < size; i++) {
+        index.insert(arr[i], static_cast<int>(i));
+    }
+    for (std::size_t t = 0; t < count; t++) {
+        int* slot = index.find(targets[t]);
+        if (slot != nullptr) {
+            result[t] = *slot;
+        }
+    }
+    return result;
+}
+
+/**
+ * Searches many targets in one array, choosing the strategy automatically
+ *
+ * @param arr: vector to search in
+ * @param targets: elements to search for
+ * @return result[i] = index of targets[i] in arr if found, -1 otherwise
+ */
+inline std::vector<int> batch_search(const std::vector<int>& arr, const std::vector<int>& targets) {
+    BatchStrategy strategy = choose_batch_strategy(arr.size(), targets.size());
+    return batch_search(arr.data(), arr.size(), targets.data(), targets.size(), strategy);
+}
+
+#endif // ALGOVAULT_SEARCHING_BATCH_SEARCH_H
@@ -10,10 +10,20 @@
  * 
  * Best Case: O(1) - element found at first position
  * Worst Case: O(n) - element at last position or not present
+ *
+ * Implementation note:
+ * The scan uses the SIMD kernels from simd_linear_search.h, which compare
+ * 4 (SSE2), 8 (AVX2) or 16 (AVX-512) ints per instruction and pick the
+ * best instruction set for the CPU at runtime. The result is the same as
+ * the plain loop: the index of the first match.
  */
 
+#include <array>
+#include <chrono>
 #include <iostream>
+#include <random>
 #include <vector>
+#include "simd_linear_search.h"
 using namespace std;
 
 /**
@@ -28,14 +38,65 @@ int linear_search(const vector<int>& arr, int target) {
         return -1;
     }
     
-    // Iterate through each element
-    for (size_t i = 0; i < arr.size(); i++) {
-        if (arr[i] == target) {
-            return i;  // Element found, return index
+    // Compare a whole vector of elements per instruction
+    return static_cast<int>(linear_search_simd(arr.data(), arr.size(), target));
+}
+
+/**
+ * Compares the std::array overload of linear_search (unrolled up to
+ * kUnrolledSearchMaxSize elements) with the scalar loop
+ */
+template <size_t N>
+bool array_search_matches() {
+    array<int, N> values{};
+    for (size_t i = 0; i < N; i++) {
+        values[i] = static_cast<int>(i % 5);  // repeated values: first match must win
+    }
+    for (int target = -1; target <= 5; target++) {
+        if (linear_search(values, target) != linear_search_scalar(values.data(), N, target)) {
+            return false;
         }
     }
-    
-    return -1;  // Element not found
+    return true;
+}
+
+/**
+ * Checks every available SIMD kernel against the scalar loop for all
+ * array sizes up to max_size and every possible match position
+ * @return true if all kernels agree with the scalar loop
+ */
+bool check_simd_kernels(int max_size) {
+    vector<SimdLevel> levels = {SimdLevel::kScalar};
+    SimdLevel best = detect_simd_level();
+    if (best >= SimdLevel::kSSE2) levels.push_back(SimdLevel::kSSE2);
+    if (best >= SimdLevel::kAVX2) levels.push_back(SimdLevel::kAVX2);
+    if (best >= SimdLevel::kAVX512) levels.push_back(SimdLevel::kAVX512);
+
+    for (int size = 0; size <= max_size; size++) {
+        vector<int> arr(size);
+        for (int i = 0; i < size; i++) {
+            arr[i] = i % 7;  // repeated values: first match must win
+        }
+        for (int target = -1; target <= 7; target++) {
+            ptrdiff_t expected = linear_search_scalar(arr.data(), arr.size(), target);
+            for (SimdLevel level : levels) {
+                if (linear_search_simd(level, arr.data(), arr.size(), target) != expected) {
+                    return false;
+                }
+            }
+        }
+        // Unique target at every position
+        for (int pos = 0; pos < size; pos++) {
+            vector<int> copy(size, 0);
+            copy[pos] = 1;
+            for (SimdLevel level : levels) {
+                if (linear_search_simd(level, copy.data(), copy.size(), 1) != pos) {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
 }
 
 // Example usage and test cases
@@ -99,6 +160,46 @@ int main() {
     if (result6 != -1) cout << " at index " << result6;
     cout << endl << endl;
     
+    // Test Case 7: SIMD kernels agree with the scalar loop
+    cout << "Test 7 - SIMD kernels vs scalar loop:" << endl;
+    cout << "CPU level: " << simd_level_name(detect_simd_level()) << endl;
+    cout << "All kernels match: " << (check_simd_kernels(200) ? "yes" : "no") << endl << endl;
+    
+    // Test Case 8: Throughput on a large array (target not present)
+    const size_t kSize = 1 << 22;
+    const int kRepetitions = 20;
+    vector<int> big(kSize);
+    mt19937 rng(1);
+    for (size_t i = 0; i < kSize; i++) {
+        big[i] = static_cast<int>(rng() & 0x3FFFFFFF);
+    }
+    cout << "Test 8 - Full scan of " << kSize << " ints:" << endl;
+    vector<SimdLevel> levels = {SimdLevel::kScalar, detect_simd_level()};
+    bool scans_correct = true;
+    for (SimdLevel level : levels) {
+        auto t0 = chrono::steady_clock::now();
+        ptrdiff_t found = 0;
+        for (int rep = 0; rep < kRepetitions; rep++) {
+            found += linear_search_simd(level, big.data(), big.size(), -1 - rep);
+        }
+        auto t1 = chrono::steady_clock::now();
+        double seconds = chrono::duration<double>(t1 - t0).count();
+        cout << simd_level_name(level) << ": "
+             << kSize * kRepetitions * sizeof(int) / seconds / 1e9 << " GB/s" << endl;
+        scans_correct = scans_correct && found == -kRepetitions;
+    }
+    cout << "Missing targets reported correct: " << (scans_correct ? "yes" : "no") << endl << endl;
+    
+    // Test Case 9: Fixed table searched at compile time
+    constexpr array<int, 6> kOpcodes = {0x10, 0x22, 0x35, 0x4f, 0x22, 0x60};
+    static_assert(linear_search(kOpcodes, 0x22) == 1, "first match found at compile time");
+    static_assert(linear_search(kOpcodes, 0x99) == -1, "missing value at compile time");
+    bool tables_match = array_search_matches<1>() && array_search_matches<7>() &&
+                        array_search_matches<32>() && array_search_matches<33>() &&
+                        array_search_matches<64>();
+    cout << "Test 9 - Compile-time index of 0x4f: " << linear_search(kOpcodes, 0x4f) << endl;
+    cout << "std::array results match: " << (tables_match ? "yes" : "no") << endl;
+    
     return 0;
 }
 
@@ -0,0 +1,267 @@
+/*
+ * SIMD Linear Search for int arrays
+ *
+ * Description:
+ * Compares many ints per instruction instead of one:
+ *   - SSE2:    4 ints per compare
+ *   - AVX2:    8 ints per compare
+ *   - AVX-512: 16 ints per compare
+ * Each loop iteration handles four vectors and ORs their compare results,
+ * so the common "no match here" case costs a single branch. When a block
+ * contains a match, a movemask (or AVX-512 compare mask) of each vector is
+ * checked in order and count-trailing-zeros gives the exact first index.
+ *
+ * The best instruction set is picked once at runtime from what the CPU
+ * supports, so one binary runs everywhere. On non-x86 targets or compilers
+ * without GCC-style target attributes only the scalar version is built.
+ *
+ * Semantics are the same as a plain loop: the index of the FIRST element
+ * equal to target, or -1 if there is none.
+ *
+ * The scalar version is constexpr, and linear_search(std::array, target)
+ * searches small fixed tables (also at compile time) with a fully
+ * unrolled, branch-free sequence of compares.
+ *
+ * Time Complexity: O(n), with n / 16 .. n / 4 compare instructions
+ * Space Complexity: O(1)
+ */
+
+#ifndef ALGOVAULT_SEARCHING_SIMD_LINEAR_SEARCH_H
+#define ALGOVAULT_SEARCHING_SIMD_LINEAR_SEARCH_H
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include "../profiling/perf_counters.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ALGOVAULT_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+/**
+ * Instruction set used by the search kernels
+ */
+enum class SimdLevel { kScalar, kSSE2, kAVX2, kAVX512 };
+
+/**
+ * @return printable name of a SIMD level
+ */
+inline const char* simd_level_name(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::kSSE2: return "SSE2";
+        case SimdLevel::kAVX2: return "AVX2";
+        case SimdLevel::kAVX512: return "AVX-512";
+        default: return "scalar";
+    }
+}
+
+/**
+ * Scalar reference: first index of target in data[0 .. size), or -1
+ */
+constexpr std::ptrdiff_t linear_search_scalar(const int* data, std::size_t size, int target) {
+    for (std::size_t i = 0; i < size; i++) {
+        if (data[i] == target) {
+            return static_cast<std::ptrdiff_t>(i);
+        }
+    }
+    return -1;
+}
+
+// Largest std::array searched with fully unrolled code
+const std::size_t kUnrolledSearchMaxSize = 32;
+
+template <typename T, std::size_t N, std::size_t... I>
+constexpr std::ptrdiff_t unrolled_linear_search(const std::array<T, N>& values, const T& target,
+                                                std::index_sequence<I...>) {
+    // Every element is compared (conditional moves, no early exit); going
+    // from the last index to the first leaves the first match in found
+    std::ptrdiff_t found = -1;
+    ((found = values[N - 1 - I] == target ? static_cast<std::ptrdiff_t>(N - 1 - I) : found), ...);
+    return found;
+}
+
+/**
+ * First index of target in a fixed-size array, or -1
+ * @param values: array to search
+ * @param target: value to find
+ */
+template <typename T, std::size_t N>
+constexpr std::ptrdiff_t linear_search(const std::array<T, N>& values, const T& target) {
+    if constexpr (N <= kUnrolledSearchMaxSize) {
+        return unrolled_linear_search(values, target, std::make_index_sequence<N>());
+    } else {
+        for (std::size_t i = 0; i < N; i++) {
+            if (values[i] == target) {
+                return static_cast<std::ptrdiff_t>(i);
+            }
+        }
+        return -1;
+    }
+}
+
+#ifdef ALGOVAULT_X86_SIMD
+
+/**
+ * SSE2 kernel (always available on x86-64)
+ */
+__attribute__((target("sse2")))
+inline std::ptrdiff_t linear_search_sse2(const int* data, std::size_t size, int target) {
+    const __m128i needle = _mm_set1_epi32(target);
+    std::size_t i = 0;
+
+    for (; i + 16 <= size; i += 16) {
+        __m128i c0 = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), needle);
+        __m128i c1 = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 4)), needle);
+        __m128i c2 = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 8)), needle);
+        __m128i c3 = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 12)), needle);
+        __m128i any = _mm_or_si128(_mm_or_si128(c0, c1), _mm_or_si128(c2, c3));
+        if (_mm_movemask_epi8(any) != 0) {
+            const __m128i hits[4] = {c0, c1, c2, c3};
+            for (int k = 0; k < 4; k++) {
+                int mask = _mm_movemask_ps(_mm_castsi128_ps(hits[k]));
+                if (mask != 0) {
+                    return static_cast<std::ptrdiff_t>(i + 4 * k + __builtin_ctz(mask));
+                }
+            }
+        }
+    }
+
+    for (; i + 4 <= size; i += 4) {
+        __m128i c = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), needle);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(c));
+        if (mask != 0) {
+            return static_cast<std::ptrdiff_t>(i + __builtin_ctz(mask));
+        }
+    }
+
+    std::ptrdiff_t tail = linear_search_scalar(data + i, size - i, target);
+    return tail < 0 ? -1 : static_cast<std::ptrdiff_t>(i) + tail;
+}
+
+/**
+ * AVX2 kernel
+ */
+__attribute__((target("avx2")))
+inline std::ptrdiff_t linear_search_avx2(const int* data, std::size_t size, int target) {
+    const __m256i needle = _mm256_set1_epi32(target);
+    std::size_t i = 0;
+
+    for (; i + 32 <= size; i += 32) {
+        __m256i c0 = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), needle);
+        __m256i c1 = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 8)), needle);
+        __m256i c2 = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 16)), needle);
+        __m256i c3 = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 24)), needle);
+        __m256i any = _mm256_or_si256(_mm256_or_si256(c0, c1), _mm256_or_si256(c2, c3));
+        if (!_mm256_testz_si256(any, any)) {
+            const __m256i hits[4] = {c0, c1, c2, c3};
+            for (int k = 0; k < 4; k++) {
+                int mask = _mm256_movemask_ps(_mm256_castsi256_ps(hits[k]));
+                if (mask != 0) {
+                    return static_cast<std::ptrdiff_t>(i + 8 * k + __builtin_ctz(mask));
+                }
+            }
+        }
+    }
+
+    for (; i + 8 <= size; i += 8) {
+        __m256i c = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)), needle);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(c));
+        if (mask != 0) {
+            return static_cast<std::ptrdiff_t>(i + __builtin_ctz(mask));
+        }
+    }
+
+    std::ptrdiff_t tail = linear_search_scalar(data + i, size - i, target);
+    return tail < 0 ? -1 : static_cast<std::ptrdiff_t>(i) + tail;
+}
+
+/**
+ * AVX-512 kernel; the tail is handled with a masked load instead of a
+ * scalar loop
+ */
+__attribute__((target("avx512f")))
+inline std::ptrdiff_t linear_search_avx512(const int* data, std::size_t size, int target) {
+    const __m512i needle = _mm512_set1_epi32(target);
+    std::size_t i = 0;
+
+    for (; i + 64 <= size; i += 64) {
+        __mmask16 m0 = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i), needle);
+        __mmask16 m1 = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i + 16), needle);
+        __mmask16 m2 = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i + 32), needle);
+        __mmask16 m3 = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512(data + i + 48), needle);
+        if ((m0 | m1 | m2 | m3) != 0) {
+            const unsigned masks[4] = {m0, m1, m2, m3};
+            for (int k = 0; k < 4; k++) {
+                if (masks[k] != 0) {
+                    return static_cast<std::ptrdiff_t>(i + 16 * k + __builtin_ctz(masks[k]));
+                }
+            }
+        }
+    }
+
+    for (; i < size; i += 16) {
+        std::size_t left = size - i;
+        __mmask16 valid = left >= 16 ? static_cast<__mmask16>(0xFFFF)
+                                     : static_cast<__mmask16>((1u << left) - 1);
+        __m512i values = _mm512_maskz_loadu_epi32(valid, data + i);
+        __mmask16 mask = _mm512_mask_cmpeq_epi32_mask(valid, values, needle);
+        if (mask != 0) {
+            return static_cast<std::ptrdiff_t>(i + __builtin_ctz(mask));
+        }
+    }
+
+    return -1;
+}
+
+#endif // ALGOVAULT_X86_SIMD
+
+/**
+ * @return the best SIMD level supported by this CPU
+ */
+inline SimdLevel detect_simd_level() {
+#ifdef ALGOVAULT_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdLevel::kAVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::kAVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return SimdLevel::kSSE2;
+    }
+#endif
+    return SimdLevel::kScalar;
+}
+
+/**
+ * Runs the kernel for a specific level (the CPU must support it)
+ */
+inline std::ptrdiff_t linear_search_simd(SimdLevel level, const int* data, std::size_t size,
+                                         int target) {
+    switch (level) {
+#ifdef ALGOVAULT_X86_SIMD
+        case SimdLevel::kAVX512: return linear_search_avx512(data, size, target);
+        case SimdLevel::kAVX2: return linear_search_avx2(data, size, target);
+        case SimdLevel::kSSE2: return linear_search_sse2(data, size, target);
+#endif
+        default: return linear_search_scalar(data, size, target);
+    }
+}
+
+/**
+ * First index of target in data[0 .. size), or -1, using the best kernel
+ * for this CPU (detected on the first call)
+ */
+inline std::ptrdiff_t linear_search_simd(const int* data, std::size_t size, int target) {
+    // Tiny arrays: the scalar loop beats any setup cost
+    if (size < 8) {
+        return linear_search_scalar(data, size, target);
+    }
+    static const SimdLevel level = detect_simd_level();
+    ALGOVAULT_PERF_SCOPE("linear_search_simd");
+    return linear_search_simd(level, data, size, target);
+}
+
+#endif // ALGOVAULT_SEARCHING_SIMD_LINEAR_SEARCH_H
@@ -0,0 +1,241 @@
+/*
+ * Sorted Array Search Examples
+ *
+ * Description:
+ * Compares the lower_bound searches from sorted_search.h with
+ * std::lower_bound: branchless binary search, the Eytzinger (BFS order)
+ * layout and the S-tree (16-key B-tree nodes searched with SIMD). All of
+ * them return indices into the original sorted array.
+ *
+ * Time Complexity: O(log n) per lookup
+ * Space Complexity: O(n) per layout
+ */
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "sorted_search.h"
+using namespace std;
+
+/**
+ * Performs binary search on a sorted vector
+ * @param arr: sorted vector to search in
+ * @param target: element to search for
+ * @return: index of the first occurrence if found, -1 otherwise
+ */
+int binary_search(const vector<int>& arr, int target) {
+    size_t i = branchless_lower_bound(arr.data(), arr.size(), target);
+    return i < arr.size() && arr[i] == target ? static_cast<int>(i) : -1;
+}
+
+/**
+ * Compares the std::array overload of branchless_lower_bound (unrolled
+ * up to kUnrolledSearchMaxSize elements) with std::lower_bound
+ */
+template <size_t N>
+bool array_lower_bound_matches(mt19937& rng) {
+    array<int, N> sorted{};
+    for (int& x : sorted) {
+        x = static_cast<int>(rng() % (2 * N));
+    }
+    sort(sorted.begin(), sorted.end());
+    for (int q = -1; q <= static_cast<int>(2 * N); q++) {
+        size_t expected = static_cast<size_t>(lower_bound(sorted.begin(), sorted.end(), q) - sorted.begin());
+        if (branchless_lower_bound(sorted, q) != expected) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Prints a vector
+ * @param arr: vector to print
+ */
+void print_vector(const vector<int>& arr) {
+    cout << "[";
+    for (size_t i = 0; i < arr.size(); i++) {
+        cout << arr[i];
+        if (i < arr.size() - 1) {
+            cout << ", ";
+        }
+    }
+    cout << "]" << endl;
+}
+
+/**
+ * Checks every search against std::lower_bound for the given queries
+ * @return true if all of them agree
+ */
+bool check_all(const vector<int>& sorted, const vector<int>& queries) {
+    EytzingerIndex eytzinger(sorted);
+    vector<STreeIndex> strees;
+    SimdLevel best = detect_simd_level();
+    strees.emplace_back(sorted, SimdLevel::kScalar);
+    if (best >= SimdLevel::kAVX2) strees.emplace_back(sorted, SimdLevel::kAVX2);
+    if (best >= SimdLevel::kAVX512) strees.emplace_back(sorted, SimdLevel::kAVX512);
+
+    for (int q : queries) {
+        size_t expected = static_cast<size_t>(
+            lower_bound(sorted.begin(), sorted.end(), q) - sorted.begin());
+        ptrdiff_t expected_find = expected < sorted.size() && sorted[expected] == q
+                                      ? static_cast<ptrdiff_t>(expected) : -1;
+        if (branchless_lower_bound(sorted.data(), sorted.size(), q) != expected ||
+            eytzinger.lower_bound(q) != expected || eytzinger.find(q) != expected_find) {
+            return false;
+        }
+        for (const STreeIndex& stree : strees) {
+            if (stree.lower_bound(q) != expected || stree.find(q) != expected_find) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Times lookups of all queries
+ * @return nanoseconds per lookup
+ */
+template <typename Lookup>
+double ns_per_lookup(const vector<int>& queries, Lookup lookup) {
+    size_t checksum = 0;
+    auto t0 = chrono::steady_clock::now();
+    for (int q : queries) {
+        checksum += lookup(q);
+    }
+    auto t1 = chrono::steady_clock::now();
+    // Keep the results alive so the loop is not optimized away
+    volatile size_t sink = checksum;
+    (void)sink;
+    return chrono::duration<double, nano>(t1 - t0).count() / queries.size();
+}
+
+// Example usage and test cases
+int main() {
+    cout << "=== Sorted Array Search Examples ===" << endl << endl;
+
+    // Test Case 1: Duplicates, missing values and values out of range
+    vector<int> arr1 = {2, 3, 3, 3, 8, 13, 21, 21, 34};
+    EytzingerIndex eytzinger1(arr1);
+    STreeIndex stree1(arr1);
+    cout << "Test 1 - Lookups in ";
+    print_vector(arr1);
+    for (int target : {3, 21, 1, 10, 34, 40}) {
+        cout << "  target=" << target
+             << "  binary_search=" << binary_search(arr1, target)
+             << "  eytzinger lower_bound=" << eytzinger1.lower_bound(target)
+             << "  s-tree lower_bound=" << stree1.lower_bound(target) << endl;
+    }
+    cout << "S-tree node search: " << simd_level_name(stree1.level()) << endl << endl;
+
+    // Test Case 2: Empty array and unsorted input
+    vector<int> empty;
+    cout << "Test 2 - Empty array:" << endl;
+    cout << "binary_search(5) = " << binary_search(empty, 5)
+         << ", eytzinger lower_bound(5) = " << EytzingerIndex(empty).lower_bound(5)
+         << ", s-tree lower_bound(5) = " << STreeIndex(empty).lower_bound(5) << endl;
+    try {
+        EytzingerIndex unsorted({3, 1, 2});
+        cout << "Unsorted input accepted (WRONG)" << endl;
+    } catch (const invalid_argument& error) {
+        cout << "Unsorted input: " << error.what() << endl;
+    }
+    cout << endl;
+
+    // Test Case 3: All searches and kernels vs std::lower_bound, every
+    // size up to 600 and a large array with extreme values
+    mt19937 rng(17);
+    bool all_match = true;
+    for (int size = 0; size <= 600; size++) {
+        vector<int> sorted(size);
+        for (int& x : sorted) {
+            x = static_cast<int>(rng() % 1000);
+        }
+        sort(sorted.begin(), sorted.end());
+        vector<int> queries;
+        for (int q = -1; q <= 1001; q++) {
+            queries.push_back(q);
+        }
+        all_match = all_match && check_all(sorted, queries);
+    }
+    vector<int> extremes(100000);
+    for (int& x : extremes) {
+        x = static_cast<int>(rng());
+    }
+    extremes[0] = INT_MIN;
+    extremes[1] = INT_MAX;
+    extremes[2] = INT_MAX;
+    sort(extremes.begin(), extremes.end());
+    vector<int> extreme_queries = {INT_MIN, INT_MIN + 1, INT_MAX - 1, INT_MAX, 0};
+    for (int i = 0; i < 10000; i++) {
+        extreme_queries.push_back(i % 2 ? extremes[rng() % extremes.size()] : static_cast<int>(rng()));
+    }
+    all_match = all_match && check_all(extremes, extreme_queries);
+
+    // Copies (and copy assignments) get storage with a different alignment
+    EytzingerIndex eytzinger3(extremes);
+    STreeIndex stree3(extremes);
+    vector<EytzingerIndex> eytzinger_copies(4, eytzinger3);
+    vector<STreeIndex> stree_copies(4, stree3);
+    eytzinger_copies[0] = EytzingerIndex(vector<int>{1, 2, 3});
+    eytzinger_copies[0] = eytzinger3;
+    stree_copies[0] = STreeIndex(vector<int>{1, 2, 3});
+    stree_copies[0] = stree3;
+    for (int target : extreme_queries) {
+        const size_t expected = lower_bound(extremes.begin(), extremes.end(), target) - extremes.begin();
+        for (size_t c = 0; c < eytzinger_copies.size(); c++) {
+            all_match = all_match && eytzinger_copies[c].lower_bound(target) == expected &&
+                        stree_copies[c].lower_bound(target) == expected;
+        }
+    }
+    cout << "Test 3 - All searches and copied indexes vs std::lower_bound:" << endl;
+    cout << "Results match: " << (all_match ? "yes" : "no") << endl << endl;
+
+    // Test Case 4: Lookup latency as the array outgrows the caches
+    const size_t kQueries = 2000000;
+    cout << "Test 4 - Random lookups (" << kQueries << " queries), ns per lookup:" << endl;
+    for (size_t size : {size_t{1} << 10, size_t{1} << 16, size_t{1} << 20, size_t{1} << 24}) {
+        vector<int> sorted(size);
+        for (int& x : sorted) {
+            x = static_cast<int>(rng() >> 1);
+        }
+        sort(sorted.begin(), sorted.end());
+        vector<int> queries(kQueries);
+        for (int& q : queries) {
+            q = static_cast<int>(rng() >> 1);
+        }
+        EytzingerIndex eytzinger(sorted);
+        STreeIndex stree(sorted);
+
+        cout << "  n=" << size
+             << "  std::lower_bound=" << ns_per_lookup(queries, [&](int q) {
+                    return static_cast<size_t>(lower_bound(sorted.begin(), sorted.end(), q) - sorted.begin());
+                })
+             << "  branchless=" << ns_per_lookup(queries, [&](int q) {
+                    return branchless_lower_bound(sorted.data(), sorted.size(), q);
+                })
+             << "  eytzinger=" << ns_per_lookup(queries, [&](int q) { return eytzinger.lower_bound(q); })
+             << "  s-tree=" << ns_per_lookup(queries, [&](int q) { return stree.lower_bound(q); })
+             << endl;
+    }
+    cout << endl;
+
+    // Test Case 5: Fixed lookup table, searched by the compiler
+    constexpr array<int, 8> kTierLimits = {0, 100, 500, 1000, 5000, 10000, 50000, 100000};
+    static_assert(branchless_lower_bound(kTierLimits, 750) == 3, "tier found at compile time");
+    static_assert(branchless_lower_bound(kTierLimits.data(), kTierLimits.size(), 100001) == 8,
+                  "past the end at compile time");
+    bool tables_match = array_lower_bound_matches<1>(rng) && array_lower_bound_matches<8>(rng) &&
+                        array_lower_bound_matches<32>(rng) && array_lower_bound_matches<33>(rng) &&
+                        array_lower_bound_matches<100>(rng);
+    cout << "Test 5 - Compile-time tier of 750: " << branchless_lower_bound(kTierLimits, 750) << endl;
+    cout << "std::array results match: " << (tables_match ? "yes" : "no") << endl;
+
+    return 0;
+}
@@ -0,0 +1,380 @@
+/*
+ * Search Indexes for sorted int arrays
+ *
+ * Description:
+ * Three ways to find lower_bound(x), the index of the first element >= x,
+ * in a sorted array. All return indices in the ORIGINAL sorted order
+ * (size if every element is < x), so they can replace std::lower_bound.
+ *
+ *   1. branchless_lower_bound: binary search where the "go right" decision
+ *      is a conditional move instead of a branch, so there are no
+ *      mispredictions, and both possible next probes are prefetched.
+ *   2. EytzingerIndex: the array is stored in BFS order of a complete
+ *      binary search tree (children of node k are 2k and 2k + 1). The
+ *      first levels of the search share a few cache lines, and the 16
+ *      nodes 4 levels below node k are adjacent, so one prefetch per step
+ *      hides most memory latency.
+ *   3. STreeIndex: a static B-tree with 16 keys per node (one 64-byte cache
+ *      line). Each node is searched with one or two SIMD compares plus a
+ *      popcount, so a lookup touches only log17(n) cache lines.
+ *
+ * The layouts store a second array mapping every slot back to its index
+ * in the sorted input.
+ *
+ * branchless_lower_bound is constexpr; its std::array overload counts the
+ * elements < x with unrolled compares for small tables, so sorted lookup
+ * tables can be built and searched at compile time.
+ *
+ * Time Complexity: O(log n) per lookup; O(n) to build a layout
+ * Space Complexity: O(n) per layout (keys + original indices)
+ */
+
+#ifndef ALGOVAULT_SEARCHING_SORTED_SEARCH_H
+#define ALGOVAULT_SEARCHING_SORTED_SEARCH_H
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "simd_linear_search.h"
+
+// Keys per S-tree node: 16 ints = one 64-byte cache line
+const std::size_t kSTreeNodeKeys = 16;
+
+/**
+ * Cache prefetch hint, skipped during constant evaluation
+ */
+constexpr void prefetch_hint(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    if (!__builtin_is_constant_evaluated()) {
+        __builtin_prefetch(address);
+    }
+#else
+    static_cast<void>(address);
+#endif
+}
+
+/**
+ * Index of the first element >= target in sorted data[0 .. size), or size
+ */
+constexpr std::size_t branchless_lower_bound(const int* data, std::size_t size, int target) {
+    if (size == 0) {
+        return 0;
+    }
+    const int* base = data;
+    std::size_t length = size;
+    while (length > 1) {
+        const std::size_t half = length / 2;
+        // The next probe is in one of the two halves: fetch both early
+        const std::size_t next_half = (length - half) / 2;
+        prefetch_hint(base + next_half);
+        prefetch_hint(base + half + next_half);
+        // Multiply instead of branch: compiles to setcc/cmov, never mispredicts
+        base += static_cast<std::size_t>(base[half - 1] < target) * half;
+        length -= half;
+    }
+    return static_cast<std::size_t>(base - data) + (*base < target);
+}
+
+template <typename T, std::size_t N, std::size_t... I>
+constexpr std::size_t unrolled_count_less(const std::array<T, N>& sorted, const T& target,
+                                          std::index_sequence<I...>) {
+    return (std::size_t{0} + ... + static_cast<std::size_t>(sorted[I] < target));
+}
+
+/**
+ * Index of the first element >= target in a sorted fixed-size array, or N
+ *
+ * In a sorted array that index is the number of elements < target; up to
+ * kUnrolledSearchMaxSize elements they are counted with unrolled compares
+ * (vectorizable, no branches), larger arrays use the halving loop.
+ */
+template <typename T, std::size_t N>
+constexpr std::size_t branchless_lower_bound(const std::array<T, N>& sorted, const T& target) {
+    if constexpr (N <= kUnrolledSearchMaxSize) {
+        return unrolled_count_less(sorted, target, std::make_index_sequence<N>());
+    } else {
+        std::size_t base = 0;
+        std::size_t length = N;
+        while (length > 1) {
+            const std::size_t half = length / 2;
+            base += static_cast<std::size_t>(sorted[base + half - 1] < target) * half;
+            length -= half;
+        }
+        return base + static_cast<std::size_t>(sorted[base] < target);
+    }
+}
+
+/**
+ * int array whose first element starts a 64-byte cache line
+ *
+ * The offset of the aligned start depends on where the storage was
+ * allocated, so a copy aligns its own storage and copies the elements
+ * instead of copying the storage as is. A move keeps the buffer and the
+ * offset.
+ */
+class CacheAlignedInts {
+public:
+    explicit CacheAlignedInts(std::size_t size = 0) : size_(size), storage_(size + 16) {
+        const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(storage_.data());
+        offset_ = (64 - address % 64) % 64 / sizeof(int);
+    }
+
+    CacheAlignedInts(const CacheAlignedInts& other) : CacheAlignedInts(other.size_) {
+        std::copy(other.data(), other.data() + size_, data());
+    }
+
+    CacheAlignedInts(CacheAlignedInts&&) noexcept = default;
+
+    CacheAlignedInts& operator=(const CacheAlignedInts& other) {
+        if (this != &other) {
+            *this = CacheAlignedInts(other);
+        }
+        return *this;
+    }
+
+    CacheAlignedInts& operator=(CacheAlignedInts&&) noexcept = default;
+
+    int* data() { return storage_.data() + offset_; }
+    const int* data() const { return storage_.data() + offset_; }
+
+private:
+    std::size_t size_;
+    std::size_t offset_;
+    std::vector<int> storage_;
+};
+
+/**
+ * Number of trailing zero bits of a nonzero value
+ */
+inline unsigned count_trailing_zeros(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(value));
+#else
+    unsigned count = 0;
+    while ((value & 1) == 0) {
+        value >>= 1;
+        count++;
+    }
+    return count;
+#endif
+}
+
+/**
+ * Throws if a search index is built from an unsorted array
+ */
+inline void check_sorted_input(const std::vector<int>& sorted) {
+    if (!std::is_sorted(sorted.begin(), sorted.end())) {
+        throw std::invalid_argument("search index input must be sorted");
+    }
+}
+
+class EytzingerIndex {
+public:
+    /**
+     * Builds the BFS layout of a sorted array
+     * @param sorted: keys in ascending order
+     */
+    explicit EytzingerIndex(const std::vector<int>& sorted)
+        : size_(sorted.size()), keys_(size_ + 1), original_(size_ + 1, 0) {
+        check_sorted_input(sorted);
+        // Node 0 is unused; nodes 1 .. n in BFS order
+        build(sorted, 0, 1);
+    }
+
+    std::size_t size() const { return size_; }
+
+    /**
+     * @return index in the sorted input of the first key >= target, or size()
+     */
+    std::size_t lower_bound(int target) const {
+        const std::size_t k = search(target);
+        return k == 0 ? size_ : original_[k];
+    }
+
+    /**
+     * @return index of target in the sorted input, -1 if absent
+     */
+    std::ptrdiff_t find(int target) const {
+        const std::size_t k = search(target);
+        return k != 0 && keys_.data()[k] == target ? static_cast<std::ptrdiff_t>(original_[k]) : -1;
+    }
+
+private:
+    // In-order traversal of the implicit tree visits keys in sorted order
+    std::size_t build(const std::vector<int>& sorted, std::size_t i, std::size_t k) {
+        if (k <= size_) {
+            i = build(sorted, i, 2 * k);
+            keys_.data()[k] = sorted[i];
+            original_[k] = i++;
+            i = build(sorted, i, 2 * k + 1);
+        }
+        return i;
+    }
+
+    // Slot of the first key >= target, 0 if there is none
+    std::size_t search(int target) const {
+        const int* keys = keys_.data();
+        std::size_t k = 1;
+        while (k <= size_) {
+            // Node 16k is the first of the 16 descendants 4 levels down
+            prefetch_hint(keys + 16 * k);
+            k = 2 * k + (keys[k] < target);
+        }
+        // Undo the right turns taken after the last left turn
+        return k >> (count_trailing_zeros(~static_cast<std::uint64_t>(k)) + 1);
+    }
+
+    std::size_t size_;
+    CacheAlignedInts keys_;
+    std::vector<std::size_t> original_;
+};
+
+/**
+ * S-tree descent: from the root, remember the last node key >= target
+ * (keys deeper in the tree are smaller) and go to the child left of it.
+ * One loop per instruction set, so the node search inlines into it.
+ * @return slot of the first key >= target, or nodes * kSTreeNodeKeys
+ */
+inline std::size_t stree_search_scalar(const int* keys, std::size_t nodes, int target) {
+    std::size_t result = nodes * kSTreeNodeKeys;
+    std::size_t node = 0;
+    while (node < nodes) {
+        const int* node_keys = keys + node * kSTreeNodeKeys;
+        unsigned rank = 0;
+        for (std::size_t j = 0; j < kSTreeNodeKeys; j++) {
+            rank += node_keys[j] < target;
+        }
+        if (rank < kSTreeNodeKeys) {
+            result = node * kSTreeNodeKeys + rank;
+        }
+        node = node * (kSTreeNodeKeys + 1) + rank + 1;
+    }
+    return result;
+}
+
+#ifdef ALGOVAULT_X86_SIMD
+
+__attribute__((target("avx2,popcnt")))
+inline std::size_t stree_search_avx2(const int* keys, std::size_t nodes, int target) {
+    const __m256i needle = _mm256_set1_epi32(target);
+    std::size_t result = nodes * kSTreeNodeKeys;
+    std::size_t node = 0;
+    while (node < nodes) {
+        const int* node_keys = keys + node * kSTreeNodeKeys;
+        const __m256i low = _mm256_load_si256(reinterpret_cast<const __m256i*>(node_keys));
+        const __m256i high = _mm256_load_si256(reinterpret_cast<const __m256i*>(node_keys + 8));
+        const unsigned mask =
+            static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(needle, low)))) |
+            static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(needle, high)))) << 8;
+        const unsigned rank = static_cast<unsigned>(__builtin_popcount(mask));
+        if (rank < kSTreeNodeKeys) {
+            result = node * kSTreeNodeKeys + rank;
+        }
+        node = node * (kSTreeNodeKeys + 1) + rank + 1;
+    }
+    return result;
+}
+
+__attribute__((target("avx512f,popcnt")))
+inline std::size_t stree_search_avx512(const int* keys, std::size_t nodes, int target) {
+    const __m512i needle = _mm512_set1_epi32(target);
+    std::size_t result = nodes * kSTreeNodeKeys;
+    std::size_t node = 0;
+    while (node < nodes) {
+        const int* node_keys = keys + node * kSTreeNodeKeys;
+        const __mmask16 less = _mm512_cmplt_epi32_mask(_mm512_load_si512(node_keys), needle);
+        const unsigned rank = static_cast<unsigned>(__builtin_popcount(less));
+        if (rank < kSTreeNodeKeys) {
+            result = node * kSTreeNodeKeys + rank;
+        }
+        node = node * (kSTreeNodeKeys + 1) + rank + 1;
+    }
+    return result;
+}
+
+#endif // ALGOVAULT_X86_SIMD
+
+class STreeIndex {
+public:
+    /**
+     * Builds the B-tree layout of a sorted array
+     * @param sorted: keys in ascending order
+     * @param level: SIMD kernel for node search (must be supported by the CPU)
+     */
+    explicit STreeIndex(const std::vector<int>& sorted, SimdLevel level = detect_simd_level())
+        : size_(sorted.size()),
+          nodes_((size_ + kSTreeNodeKeys - 1) / kSTreeNodeKeys),
+          keys_(nodes_ * kSTreeNodeKeys),
+          original_(nodes_ * kSTreeNodeKeys),
+          level_(level) {
+        check_sorted_input(sorted);
+        std::size_t next = 0;
+        build(sorted, 0, next);
+    }
+
+    std::size_t size() const { return size_; }
+
+    /**
+     * @return SIMD kernel used for node search
+     */
+    SimdLevel level() const { return level_; }
+
+    /**
+     * @return index in the sorted input of the first key >= target, or size()
+     */
+    std::size_t lower_bound(int target) const {
+        const std::size_t slot = search(target);
+        return slot < original_.size() ? original_[slot] : size_;
+    }
+
+    /**
+     * @return index of target in the sorted input, -1 if absent
+     */
+    std::ptrdiff_t find(int target) const {
+        const std::size_t slot = search(target);
+        if (slot < original_.size() && original_[slot] < size_ && keys_.data()[slot] == target) {
+            return static_cast<std::ptrdiff_t>(original_[slot]);
+        }
+        return -1;
+    }
+
+private:
+    // In-order traversal: child i of a node holds the keys before key i.
+    // Slots past the input get INT_MAX and the original index size().
+    void build(const std::vector<int>& sorted, std::size_t node, std::size_t& next) {
+        if (node >= nodes_) {
+            return;
+        }
+        for (std::size_t i = 0; i < kSTreeNodeKeys; i++) {
+            build(sorted, node * (kSTreeNodeKeys + 1) + i + 1, next);
+            const std::size_t slot = node * kSTreeNodeKeys + i;
+            keys_.data()[slot] = next < size_ ? sorted[next] : INT_MAX;
+            original_[slot] = std::min(next, size_);
+            next++;
+        }
+        build(sorted, node * (kSTreeNodeKeys + 1) + kSTreeNodeKeys + 1, next);
+    }
+
+    std::size_t search(int target) const {
+        switch (level_) {
+#ifdef ALGOVAULT_X86_SIMD
+            case SimdLevel::kAVX512: return stree_search_avx512(keys_.data(), nodes_, target);
+            case SimdLevel::kAVX2: return stree_search_avx2(keys_.data(), nodes_, target);
+#endif
+            default: return stree_search_scalar(keys_.data(), nodes_, target);
+        }
+    }
+
+    std::size_t size_;
+    std::size_t nodes_;
+    CacheAlignedInts keys_;
+    std::vector<std::size_t> original_;
+    SimdLevel level_;
+};
+
+#endif // ALGOVAULT_SEARCHING_SORTED_SEARCH_H
@@ -11,10 +11,20 @@
  * 
  * Best Case: O(n) - when array is already sorted (with optimization)
  * Worst Case: O(n^2) - when array is reverse sorted
+ *
+ * The algorithm itself lives in bubble_sort.h as an iterator-range template
+ * with comparator and projection, so it also sorts doubles, strings or
+ * records by a key. bubble_sort(vector<int>&) is the simple int entry point.
  */
 
+#include <algorithm>
+#include <array>
+#include <functional>
 #include <iostream>
+#include <random>
+#include <string>
 #include <vector>
+#include "bubble_sort.h"
 using namespace std;
 
 /**
@@ -22,40 +32,71 @@ using namespace std;
  * @param arr: vector to be sorted (passed by reference)
  */
 void bubble_sort(vector<int>& arr) {
-    int n = arr.size();
-    
-    // Edge case: empty or single element array
-    if (n <= 1) {
-        return;
+    bubble_sort(arr.begin(), arr.end());
+}
+
+/**
+ * Example record type: sorted by key without copying keys out
+ */
+struct Record {
+    int key;
+    string name;
+};
+
+/**
+ * Literal record type, so arrays of it can be sorted at compile time
+ */
+struct Task {
+    int priority;
+    char name;
+};
+
+/**
+ * Sorted copy of a fixed-size array; constexpr, so usable for constants
+ */
+template <typename T, size_t N, typename Projection = Identity>
+constexpr array<T, N> sorted_copy(array<T, N> values, Projection proj = {}) {
+    bubble_sort(values, less<>(), proj);
+    return values;
+}
+
+template <size_t N>
+constexpr bool is_sorted_table(const array<int, N>& values) {
+    for (size_t i = 1; i < N; i++) {
+        if (values[i] < values[i - 1]) {
+            return false;
+        }
     }
-    
-    bool swapped;
-    
-    // Outer loop for each pass
-    for (int i = 0; i < n - 1; i++) {
-        swapped = false;
-        
-        // Inner loop for comparing adjacent elements
-        for (int j = 0; j < n - i - 1; j++) {
-            // Swap if current element is greater than next
-            if (arr[j] > arr[j + 1]) {
-                swap(arr[j], arr[j + 1]);
-                swapped = true;
-            }
+    return true;
+}
+
+/**
+ * Sorts random arrays of size N with the std::array overload (unrolled up
+ * to kUnrolledSortMaxSize) and compares with std::sort
+ */
+template <size_t N>
+bool array_sort_matches_std_sort(mt19937& rng) {
+    for (int trial = 0; trial < 200; trial++) {
+        array<int, N> values{};
+        for (int& x : values) {
+            x = static_cast<int>(rng() % 8);
         }
-        
-        // If no swaps occurred, array is sorted
-        if (!swapped) {
-            break;
+        array<int, N> expected = values;
+        sort(expected.begin(), expected.end());
+        bubble_sort(values);
+        if (values != expected) {
+            return false;
         }
     }
+    return true;
 }
 
 /**
  * Prints a vector
  * @param arr: vector to print
  */
-void print_vector(const vector<int>& arr) {
+template <typename T>
+void print_vector(const vector<T>& arr) {
     cout << "[";
     for (size_t i = 0; i < arr.size(); i++) {
         cout << arr[i];
@@ -130,6 +171,62 @@ int main() {
     print_vector(arr6);
     cout << endl;
     
+    // Test Case 7: Doubles in descending order (custom comparator)
+    vector<double> arr7 = {2.5, -1.0, 3.75, 0.0, 2.5};
+    cout << "Test 7 - Doubles, descending:" << endl;
+    cout << "Before: ";
+    print_vector(arr7);
+    bubble_sort(arr7.begin(), arr7.end(), greater<>());
+    cout << "After:  ";
+    print_vector(arr7);
+    cout << endl;
+    
+    // Test Case 8: Records sorted by key (projection), stable for equal keys
+    vector<Record> arr8 = {{3, "c"}, {1, "a"}, {2, "b1"}, {2, "b2"}, {0, "z"}};
+    cout << "Test 8 - Records by key:" << endl;
+    bubble_sort(arr8.begin(), arr8.end(), less<>(), &Record::key);
+    cout << "After:  ";
+    for (const Record& r : arr8) {
+        cout << "(" << r.key << ", " << r.name << ") ";
+    }
+    cout << endl << endl;
+    
+    // Test Case 9: Strings by length (projection returning a value)
+    vector<string> arr9 = {"banana", "fig", "apple", "kiwi"};
+    cout << "Test 9 - Strings by length:" << endl;
+    bubble_sort(arr9.begin(), arr9.end(), less<>(), [](const string& s) { return s.size(); });
+    cout << "After:  ";
+    print_vector(arr9);
+    cout << endl;
+    
+    // Test Case 10: Lookup tables sorted at compile time (unrolled and loop versions)
+    constexpr array<int, 8> kSmallTable = sorted_copy(array<int, 8>{19, 2, 17, 3, 13, 5, 11, 7});
+    constexpr array<int, 20> kLargeTable =
+        sorted_copy(array<int, 20>{9, 3, 14, 0, 19, 7, 11, 2, 16, 5, 1, 18, 8, 12, 4, 17, 6, 15, 10, 13});
+    static_assert(is_sorted_table(kSmallTable) && kSmallTable[0] == 2, "small table sorted by the compiler");
+    static_assert(is_sorted_table(kLargeTable) && kLargeTable[19] == 19, "large table sorted by the compiler");
+    cout << "Test 10 - Compile-time sorted table: ";
+    print_vector(vector<int>(kSmallTable.begin(), kSmallTable.end()));
+    cout << endl;
+    
+    // Test Case 11: Records by key at compile time, stable
+    constexpr array<Task, 5> kTasks = sorted_copy(
+        array<Task, 5>{{{2, 'a'}, {1, 'b'}, {2, 'c'}, {0, 'd'}, {1, 'e'}}}, &Task::priority);
+    static_assert(kTasks[0].name == 'd' && kTasks[1].name == 'b' && kTasks[2].name == 'e' &&
+                  kTasks[3].name == 'a' && kTasks[4].name == 'c', "stable compile-time sort by key");
+    cout << "Test 11 - Compile-time tasks by priority: ";
+    for (const Task& t : kTasks) {
+        cout << "(" << t.priority << ", " << t.name << ") ";
+    }
+    cout << endl << endl;
+    
+    // Test Case 12: std::array overload against std::sort, unrolled and loop sizes
+    mt19937 rng(12);
+    bool all_match = array_sort_matches_std_sort<1>(rng) && array_sort_matches_std_sort<2>(rng) &&
+                     array_sort_matches_std_sort<5>(rng) && array_sort_matches_std_sort<16>(rng) &&
+                     array_sort_matches_std_sort<17>(rng) && array_sort_matches_std_sort<40>(rng);
+    cout << "Test 12 - std::array results match std::sort: " << (all_match ? "yes" : "no") << endl;
+    
     return 0;
 }
 
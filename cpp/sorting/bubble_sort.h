@@ -0,0 +1,87 @@
+/*
+ * Bubble Sort (generic version)
+ *
+ * Description:
+ * Repeatedly swaps adjacent elements that are in the wrong order. After
+ * each pass everything behind the last swap is already in place, so the
+ * next pass stops there; a pass without swaps ends the sort early.
+ *
+ * Works on any random access range, with a comparator and a projection
+ * (see sort_utils.h). Equal elements keep their order (stable).
+ *
+ * Both versions are constexpr, e.g. for tables sorted at compile time.
+ * The std::array overload unrolls the passes completely for small N: a
+ * fixed sequence of compare-exchanges without loop counters or swap flags.
+ *
+ * Time Complexity: O(n^2), O(n) if already sorted
+ * Space Complexity: O(1)
+ */
+
+#ifndef ALGOVAULT_SORTING_BUBBLE_SORT_H
+#define ALGOVAULT_SORTING_BUBBLE_SORT_H
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include "sort_utils.h"
+
+/**
+ * Sorts [first, last) using bubble sort
+ * @param first, last: random access range to sort
+ * @param comp: strict weak ordering on projected values
+ * @param proj: projection applied before comparing
+ */
+template <typename RandomIt, typename Compare = std::less<>, typename Projection = Identity>
+constexpr void bubble_sort(RandomIt first, RandomIt last, Compare comp = {}, Projection proj = {}) {
+    auto less = make_projected_less(std::move(comp), std::move(proj));
+    auto n = last - first;
+
+    while (n > 1) {
+        // Position after the last swap; everything from there on is sorted
+        decltype(n) last_swap = 0;
+        for (decltype(n) j = 1; j < n; j++) {
+            if (less(first[j], first[j - 1])) {
+                constexpr_iter_swap(first + j, first + (j - 1));
+                last_swap = j;
+            }
+        }
+        n = last_swap;
+    }
+}
+
+/**
+ * One unrolled pass: compare-exchange (0, 1), (1, 2), ..., (J, J + 1)
+ */
+template <typename T, std::size_t N, typename Less, std::size_t... J>
+constexpr void unrolled_bubble_pass(std::array<T, N>& values, Less& less, std::index_sequence<J...>) {
+    (compare_exchange(values[J], values[J + 1], less), ...);
+}
+
+/**
+ * All passes; pass P stops before the P largest elements already in place
+ */
+template <typename T, std::size_t N, typename Less, std::size_t... P>
+constexpr void unrolled_bubble_sort(std::array<T, N>& values, Less& less, std::index_sequence<P...>) {
+    (unrolled_bubble_pass(values, less, std::make_index_sequence<N - 1 - P>()), ...);
+}
+
+/**
+ * Sorts a std::array using bubble sort, fully unrolled up to
+ * kUnrolledSortMaxSize elements
+ * @param values: array to sort
+ * @param comp: strict weak ordering on projected values
+ * @param proj: projection applied before comparing
+ */
+template <typename T, std::size_t N, typename Compare = std::less<>, typename Projection = Identity>
+constexpr void bubble_sort(std::array<T, N>& values, Compare comp = {}, Projection proj = {}) {
+    if constexpr (N > 1 && N <= kUnrolledSortMaxSize) {
+        auto less = make_projected_less(std::move(comp), std::move(proj));
+        unrolled_bubble_sort(values, less, std::make_index_sequence<N - 1>());
+    } else {
+        bubble_sort(values.begin(), values.end(), std::move(comp), std::move(proj));
+    }
+}
+
+#endif // ALGOVAULT_SORTING_BUBBLE_SORT_H
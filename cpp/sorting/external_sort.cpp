@@ -0,0 +1,173 @@
+/*
+ * External Merge Sort Examples
+ *
+ * Description:
+ * external_sort() (see external_sort.h) sorts binary files of 64-bit keys
+ * that do not fit in memory: sorted runs of half the memory budget are
+ * spilled to temporary files and merged with a loser tree.
+ *
+ * Time Complexity: O(n log n), O(n * (1 + merge passes)) I/O
+ * Space Complexity: O(memory budget) RAM, O(n) temporary disk space
+ *
+ * Usage:
+ *     ./external_sort                                 run the examples
+ *     ./external_sort input output [budget_mb] [tmp]  sort a file of uint64 keys
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "external_sort.h"
+using namespace std;
+
+/**
+ * Writes n random keys to a file
+ * @return sum of all keys (wrapping), used as a checksum
+ */
+uint64_t write_random_keys(const string& path, uint64_t n, uint64_t max_key, unsigned seed) {
+    mt19937_64 rng(seed);
+    KeyFileWriter<uint64_t> writer(path, 1 << 16);
+    uint64_t checksum = 0;
+    for (uint64_t i = 0; i < n; i++) {
+        uint64_t key = max_key == 0 ? rng() : rng() % max_key;
+        checksum += key;
+        writer.push(key);
+    }
+    writer.finish();
+    return checksum;
+}
+
+/**
+ * Checks that a file is sorted and has the expected size and checksum
+ */
+bool is_sorted_file(const string& path, uint64_t n, uint64_t checksum) {
+    KeyFileReader<uint64_t> reader(path, 1 << 16);
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t previous = 0;
+    uint64_t key;
+    while (reader.next(key)) {
+        if (count > 0 && key < previous) {
+            return false;
+        }
+        previous = key;
+        sum += key;
+        count++;
+    }
+    return count == n && sum == checksum;
+}
+
+/**
+ * Prints the first keys of a file
+ */
+void print_file(const string& path, size_t limit) {
+    KeyFileReader<uint64_t> reader(path, 1 << 16);
+    uint64_t key;
+    cout << "[";
+    for (size_t i = 0; i < limit && reader.next(key); i++) {
+        cout << (i > 0 ? ", " : "") << key;
+    }
+    cout << "]" << endl;
+}
+
+/**
+ * Sorts a test file and reports the result
+ */
+void run_test(const string& name, uint64_t n, uint64_t max_key,
+              const ExternalSortOptions& options) {
+    filesystem::path dir = filesystem::temp_directory_path();
+    string input = (dir / "algovault_external_sort_in.bin").string();
+    string output = (dir / "algovault_external_sort_out.bin").string();
+
+    uint64_t checksum = write_random_keys(input, n, max_key, 42);
+    auto t0 = chrono::steady_clock::now();
+    ExternalSortStats stats = external_sort<uint64_t>(input, output, options);
+    auto t1 = chrono::steady_clock::now();
+
+    cout << name << ":" << endl;
+    cout << "Keys: " << stats.elements << ", budget: " << (options.memory_budget_bytes >> 10)
+         << " KiB, runs: " << stats.initial_runs << ", fan-in: " << stats.fan_in
+         << ", merge passes: " << stats.merge_passes << endl;
+    if (n <= 16) {
+        cout << "Output: ";
+        print_file(output, 16);
+    }
+    cout << "Sorted correctly: " << (is_sorted_file(output, n, checksum) ? "yes" : "no") << endl;
+    cout << "Time: " << chrono::duration<double, milli>(t1 - t0).count() << " ms" << endl << endl;
+
+    remove(input.c_str());
+    remove(output.c_str());
+}
+
+// Example usage and test cases
+int main(int argc, char* argv[]) {
+    if (argc >= 3) {
+        ExternalSortOptions options;
+        if (argc > 3) {
+            options.memory_budget_bytes = static_cast<size_t>(atoll(argv[3])) << 20;
+        }
+        if (argc > 4) {
+            options.temp_dir = argv[4];
+        }
+        try {
+            ExternalSortStats stats = external_sort<uint64_t>(argv[1], argv[2], options);
+            cout << "Sorted " << stats.elements << " keys (" << stats.initial_runs
+                 << " runs, " << stats.merge_passes << " merge passes)" << endl;
+        } catch (const exception& error) {
+            cerr << error.what() << endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    cout << "=== External Merge Sort Examples ===" << endl << endl;
+
+    ExternalSortOptions small;
+    small.memory_budget_bytes = 64 << 10;
+    small.io_buffer_bytes = 4 << 10;
+
+    // Test Case 1: Fits in memory, sorted without temporary files
+    run_test("Test 1 - Small file (one run)", 10, 100, small);
+
+    // Test Case 2: Empty file
+    run_test("Test 2 - Empty file", 0, 0, small);
+
+    // Test Case 3: 15 runs merged in one pass
+    run_test("Test 3 - 60000 keys, 64 KiB budget", 60000, 0, small);
+
+    // Test Case 4: More runs than the fan-in: two merge passes
+    run_test("Test 4 - 200000 keys with duplicates, 64 KiB budget", 200000, 1000, small);
+
+    // Test Case 5: Exactly one full run: renamed into place, no merge
+    run_test("Test 5 - 4096 keys (one full run), 64 KiB budget", 4096, 0, small);
+
+    // Test Case 6: 16 runs with a fan-in of 15: the lone 16th run skips the
+    // first pass and is merged in the second
+    run_test("Test 6 - 65536 keys (16 runs), 64 KiB budget", 65536, 0, small);
+
+    // Test Case 7: 64 MiB of keys with an 8 MiB budget and 1 MiB I/O blocks
+    ExternalSortOptions medium;
+    medium.memory_budget_bytes = 8 << 20;
+    medium.io_buffer_bytes = 1 << 20;
+    run_test("Test 7 - 8M keys (64 MiB), 8 MiB budget", 8 << 20, 0, medium);
+
+    // Test Case 8: Budget too small for the I/O blocks
+    ExternalSortOptions too_small;
+    too_small.memory_budget_bytes = 1 << 10;
+    too_small.io_buffer_bytes = 1 << 10;
+    cout << "Test 8 - Budget smaller than 3 I/O blocks:" << endl;
+    try {
+        external_sort<uint64_t>("unused_input.bin", "unused_output.bin", too_small);
+        cout << "No error (WRONG)" << endl;
+    } catch (const invalid_argument& error) {
+        cout << "Error: " << error.what() << endl;
+    }
+
+    return 0;
+}
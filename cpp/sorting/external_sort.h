@@ -0,0 +1,457 @@
+/*
+ * External Merge Sort for binary files of integer keys
+ *
+ * Description:
+ * Sorts a file of fixed-size integer keys (native byte order, no header)
+ * that may be much larger than RAM, using at most a given memory budget:
+ *
+ *   1. Run formation: the input is read in chunks of half the budget,
+ *      each chunk is sorted in memory with radix_sort (the other half is
+ *      the radix sort buffer) and written to a temporary run file.
+ *   2. Merging: up to fan_in runs are merged at once with a loser tree,
+ *      where fan_in is how many I/O buffers fit in the budget. If there are
+ *      more runs, several merge passes are made, each writing longer runs.
+ *      The last pass writes the output file.
+ *
+ * All I/O is sequential, in blocks of io_buffer_bytes, through unbuffered
+ * stdio streams (the block buffers replace the stdio buffers). An input
+ * that fits in one chunk is sorted without temporary files.
+ *
+ * Errors (missing files, short reads or writes, a file size that is not a
+ * multiple of the key size) are reported with std::runtime_error, and
+ * temporary files are removed in every case.
+ *
+ * Time Complexity: O(n log n) total, with 2 * n * (1 + merge passes) bytes
+ *                  of I/O, merge passes = ceil(log_fan_in(runs)) - 1
+ * Space Complexity: O(memory budget) RAM, O(n) temporary disk space
+ */
+
+#ifndef ALGOVAULT_SORTING_EXTERNAL_SORT_H
+#define ALGOVAULT_SORTING_EXTERNAL_SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "radix_sort.h"
+
+/**
+ * Parameters of an external sort
+ * - memory_budget_bytes: RAM used for run buffers and I/O buffers
+ * - io_buffer_bytes: size of one sequential read or write
+ * - temp_dir: directory for run files (empty: the system temp directory)
+ */
+struct ExternalSortOptions {
+    std::size_t memory_budget_bytes = std::size_t{256} << 20;
+    std::size_t io_buffer_bytes = std::size_t{4} << 20;
+    std::string temp_dir;
+};
+
+/**
+ * What an external sort did
+ */
+struct ExternalSortStats {
+    std::uint64_t elements = 0;
+    std::size_t initial_runs = 0;
+    std::size_t merge_passes = 0;
+    std::size_t fan_in = 0;
+};
+
+/**
+ * Tournament tree over k sorted sources that keeps the loser of every
+ * match in the inner nodes. Replacing the winner's key replays only the
+ * log2(k) matches on its path, comparing against the stored losers, and
+ * never needs the sibling's key. Ties go to the lower source index.
+ */
+template <typename Key>
+class LoserTree {
+public:
+    /**
+     * @param sources: number of sources k (padded to a power of two)
+     */
+    explicit LoserTree(std::size_t sources) {
+        leaves_ = 1;
+        while (leaves_ < sources) {
+            leaves_ *= 2;
+        }
+        tree_.assign(leaves_, 0);
+        keys_.assign(leaves_, Key{});
+        active_.assign(leaves_, false);
+    }
+
+    /**
+     * Sets the first key of a source, before build()
+     */
+    void set(std::size_t source, Key key) {
+        keys_[source] = key;
+        active_[source] = true;
+    }
+
+    /**
+     * Plays all matches once the first keys are set
+     */
+    void build() {
+        std::vector<std::size_t> winner(2 * leaves_);
+        for (std::size_t i = 0; i < leaves_; i++) {
+            winner[leaves_ + i] = i;
+        }
+        for (std::size_t node = leaves_ - 1; node >= 1; node--) {
+            const std::size_t a = winner[2 * node];
+            const std::size_t b = winner[2 * node + 1];
+            winner[node] = beats(a, b) ? a : b;
+            tree_[node] = beats(a, b) ? b : a;
+        }
+        tree_[0] = winner[1];
+    }
+
+    /**
+     * @return true when every source is exhausted
+     */
+    bool empty() const { return !active_[tree_[0]]; }
+
+    /**
+     * @return source holding the smallest key
+     */
+    std::size_t winner() const { return tree_[0]; }
+
+    /**
+     * @return the smallest key
+     */
+    Key winner_key() const { return keys_[tree_[0]]; }
+
+    /**
+     * Replaces the winner's key with the next key of its source
+     */
+    void replace_winner(Key key) {
+        keys_[tree_[0]] = key;
+        replay();
+    }
+
+    /**
+     * Marks the winner's source as exhausted
+     */
+    void remove_winner() {
+        active_[tree_[0]] = false;
+        replay();
+    }
+
+private:
+    bool beats(std::size_t a, std::size_t b) const {
+        if (!active_[a] || !active_[b]) {
+            return active_[a];
+        }
+        return keys_[a] < keys_[b] || (keys_[a] == keys_[b] && a < b);
+    }
+
+    void replay() {
+        std::size_t current = tree_[0];
+        for (std::size_t node = (leaves_ + current) / 2; node >= 1; node /= 2) {
+            if (beats(tree_[node], current)) {
+                std::swap(tree_[node], current);
+            }
+        }
+        tree_[0] = current;
+    }
+
+    std::size_t leaves_;
+    std::vector<std::size_t> tree_;  // tree_[0] = winner, others = losers
+    std::vector<Key> keys_;
+    std::vector<bool> active_;
+};
+
+/**
+ * Opens a file for unbuffered binary I/O, throws on failure
+ */
+inline std::FILE* external_sort_open(const std::string& path, const char* mode) {
+    std::FILE* file = std::fopen(path.c_str(), mode);
+    if (file == nullptr) {
+        throw std::runtime_error("external_sort: cannot open " + path);
+    }
+    std::setvbuf(file, nullptr, _IONBF, 0);
+    return file;
+}
+
+/**
+ * Reads a file of keys sequentially, one block at a time
+ */
+template <typename Key>
+class KeyFileReader {
+public:
+    KeyFileReader(const std::string& path, std::size_t buffer_keys)
+        : path_(path), file_(external_sort_open(path, "rb")), buffer_(buffer_keys) {}
+
+    KeyFileReader(const KeyFileReader&) = delete;
+    KeyFileReader& operator=(const KeyFileReader&) = delete;
+
+    ~KeyFileReader() { std::fclose(file_); }
+
+    /**
+     * Fills keys with up to count keys
+     * @return number of keys read, 0 at the end of the file
+     */
+    std::size_t read(Key* keys, std::size_t count) {
+        const std::size_t bytes = std::fread(keys, 1, count * sizeof(Key), file_);
+        if (std::ferror(file_)) {
+            throw std::runtime_error("external_sort: read error in " + path_);
+        }
+        if (bytes % sizeof(Key) != 0) {
+            throw std::runtime_error("external_sort: size of " + path_ +
+                                     " is not a multiple of the key size");
+        }
+        return bytes / sizeof(Key);
+    }
+
+    /**
+     * Reads the next key through the block buffer
+     * @return false at the end of the file
+     */
+    bool next(Key& key) {
+        if (position_ == size_) {
+            size_ = read(buffer_.data(), buffer_.size());
+            position_ = 0;
+            if (size_ == 0) {
+                return false;
+            }
+        }
+        key = buffer_[position_++];
+        return true;
+    }
+
+private:
+    std::string path_;
+    std::FILE* file_;
+    std::vector<Key> buffer_;
+    std::size_t position_ = 0;
+    std::size_t size_ = 0;
+};
+
+/**
+ * Writes a file of keys sequentially, one block at a time
+ */
+template <typename Key>
+class KeyFileWriter {
+public:
+    KeyFileWriter(const std::string& path, std::size_t buffer_keys)
+        : path_(path), file_(external_sort_open(path, "wb")) {
+        buffer_.reserve(buffer_keys);
+    }
+
+    KeyFileWriter(const KeyFileWriter&) = delete;
+    KeyFileWriter& operator=(const KeyFileWriter&) = delete;
+
+    ~KeyFileWriter() { std::fclose(file_); }
+
+    void push(Key key) {
+        buffer_.push_back(key);
+        if (buffer_.size() == buffer_.capacity()) {
+            flush();
+        }
+    }
+
+    /**
+     * Writes count keys directly, bypassing the block buffer
+     */
+    void write(const Key* keys, std::size_t count) {
+        flush();
+        if (std::fwrite(keys, sizeof(Key), count, file_) != count) {
+            throw std::runtime_error("external_sort: write error in " + path_);
+        }
+    }
+
+    /**
+     * Writes the buffered keys and closes the file
+     */
+    void finish() {
+        flush();
+        if (std::fflush(file_) != 0) {
+            throw std::runtime_error("external_sort: write error in " + path_);
+        }
+    }
+
+private:
+    void flush() {
+        if (!buffer_.empty() &&
+            std::fwrite(buffer_.data(), sizeof(Key), buffer_.size(), file_) != buffer_.size()) {
+            throw std::runtime_error("external_sort: write error in " + path_);
+        }
+        buffer_.clear();
+    }
+
+    std::string path_;
+    std::FILE* file_;
+    std::vector<Key> buffer_;
+};
+
+/**
+ * Names temporary run files and removes them when destroyed
+ */
+class TempRunFiles {
+public:
+    explicit TempRunFiles(const std::string& dir) {
+        std::filesystem::path base = dir.empty() ? std::filesystem::temp_directory_path()
+                                                 : std::filesystem::path(dir);
+        std::random_device random;
+        prefix_ = (base / ("algovault_run_" + std::to_string(random()) + "_")).string();
+    }
+
+    TempRunFiles(const TempRunFiles&) = delete;
+    TempRunFiles& operator=(const TempRunFiles&) = delete;
+
+    ~TempRunFiles() {
+        for (const std::string& path : created_) {
+            std::remove(path.c_str());
+        }
+    }
+
+    /**
+     * @return path for a new run file
+     */
+    std::string create() {
+        created_.push_back(prefix_ + std::to_string(created_.size()) + ".bin");
+        return created_.back();
+    }
+
+    /**
+     * Deletes a run file that is no longer needed
+     */
+    static void release(const std::string& path) { std::remove(path.c_str()); }
+
+private:
+    std::string prefix_;
+    std::vector<std::string> created_;
+};
+
+/**
+ * Merges sorted run files into one sorted file with a loser tree
+ */
+template <typename Key>
+void merge_key_runs(const std::vector<std::string>& runs, const std::string& output_path,
+                    std::size_t buffer_keys) {
+    std::vector<std::unique_ptr<KeyFileReader<Key>>> readers;
+    LoserTree<Key> tree(runs.size());
+    for (std::size_t r = 0; r < runs.size(); r++) {
+        readers.push_back(std::make_unique<KeyFileReader<Key>>(runs[r], buffer_keys));
+        Key key;
+        if (readers[r]->next(key)) {
+            tree.set(r, key);
+        }
+    }
+    tree.build();
+
+    KeyFileWriter<Key> writer(output_path, buffer_keys);
+    while (!tree.empty()) {
+        writer.push(tree.winner_key());
+        Key key;
+        if (readers[tree.winner()]->next(key)) {
+            tree.replace_winner(key);
+        } else {
+            tree.remove_winner();
+        }
+    }
+    writer.finish();
+}
+
+/**
+ * Sorts a binary file of integer keys within a memory budget
+ *
+ * @param input_path: file of keys in native byte order
+ * @param output_path: sorted output (may not be the input file)
+ * @param options: memory budget, I/O block size and temp directory
+ * @return number of keys, runs and merge passes
+ */
+template <typename Key = std::uint64_t>
+ExternalSortStats external_sort(const std::string& input_path, const std::string& output_path,
+                                const ExternalSortOptions& options = {}) {
+    static_assert(std::is_integral<Key>::value, "external_sort needs integer keys");
+
+    const std::size_t buffer_keys = std::max<std::size_t>(1, options.io_buffer_bytes / sizeof(Key));
+    const std::size_t budget_keys = options.memory_budget_bytes / sizeof(Key);
+    // Half the budget holds the run, the other half is the radix sort buffer
+    const std::size_t run_keys = budget_keys / 2;
+    // One input buffer per run plus one output buffer
+    const std::size_t fan_in = budget_keys / buffer_keys - 1;
+    if (run_keys < buffer_keys || fan_in < 2) {
+        throw std::invalid_argument("external_sort: memory budget must hold at least "
+                                    "3 I/O buffers");
+    }
+
+    ExternalSortStats stats;
+    stats.fan_in = fan_in;
+    TempRunFiles temp(options.temp_dir);
+    std::vector<std::string> runs;
+
+    // 1. Run formation
+    {
+        KeyFileReader<Key> input(input_path, 0);
+        std::vector<Key> chunk(run_keys);
+        while (true) {
+            std::size_t size = 0;
+            while (size < run_keys) {
+                const std::size_t read = input.read(chunk.data() + size,
+                                                    std::min(buffer_keys, run_keys - size));
+                if (read == 0) {
+                    break;
+                }
+                size += read;
+            }
+            if (size == 0 && !runs.empty()) {
+                break;
+            }
+            stats.elements += size;
+            radix_sort(chunk.begin(), chunk.begin() + static_cast<std::ptrdiff_t>(size));
+
+            // Everything fit in one chunk: no merge needed
+            const bool only_run = runs.empty() && size < run_keys;
+            runs.push_back(only_run ? output_path : temp.create());
+            KeyFileWriter<Key> writer(runs.back(), 0);
+            for (std::size_t i = 0; i < size; i += buffer_keys) {
+                writer.write(chunk.data() + i, std::min(buffer_keys, size - i));
+            }
+            writer.finish();
+            if (only_run) {
+                stats.initial_runs = 1;
+                return stats;
+            }
+        }
+    }
+    stats.initial_runs = runs.size();
+
+    // 2. Merge passes, fan_in runs at a time; the last one writes the output
+    while (runs.size() > 1) {
+        const bool last_pass = runs.size() <= fan_in;
+        std::vector<std::string> merged;
+        for (std::size_t begin = 0; begin < runs.size(); begin += fan_in) {
+            const std::size_t end = std::min(runs.size(), begin + fan_in);
+            // A lone run at the end goes on to the next pass as it is
+            if (end - begin == 1) {
+                merged.push_back(runs[begin]);
+                continue;
+            }
+            std::vector<std::string> group(runs.begin() + static_cast<std::ptrdiff_t>(begin),
+                                           runs.begin() + static_cast<std::ptrdiff_t>(end));
+            merged.push_back(last_pass ? output_path : temp.create());
+            merge_key_runs<Key>(group, merged.back(), buffer_keys);
+            for (const std::string& run : group) {
+                TempRunFiles::release(run);
+            }
+        }
+        runs = merged;
+        stats.merge_passes++;
+    }
+
+    // A single full-size run was written to a temporary file: move it into
+    // place, copy only if it cannot be renamed (e.g. another file system)
+    if (runs.front() != output_path && std::rename(runs.front().c_str(), output_path.c_str()) != 0) {
+        merge_key_runs<Key>(runs, output_path, buffer_keys);
+    }
+    return stats;
+}
+
+#endif // ALGOVAULT_SORTING_EXTERNAL_SORT_H
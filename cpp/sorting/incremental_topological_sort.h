@@ -0,0 +1,257 @@
+/*
+ * Incremental Topological Order (Pearce-Kelly Algorithm)
+ *
+ * Description:
+ * Keeps a topological order of a DAG up to date while edges are inserted
+ * and deleted, instead of re-running a full O(V + E) topological sort after
+ * every change.
+ *
+ * Every vertex v has a position ord[v] in the current order. Inserting an
+ * edge x -> y is free when ord[x] < ord[y]. Otherwise only the "affected
+ * region" between ord[y] and ord[x] can be out of order:
+ *
+ *   1. Forward search from y, only through vertices with ord < ord[x]
+ *      (delta_f). Reaching x means the edge would close a cycle: the edge
+ *      is rejected and the cycle x -> y -> ... -> x is returned.
+ *   2. Backward search from x, only through vertices with ord > ord[y]
+ *      (delta_b).
+ *   3. The positions used by delta_b and delta_f are reassigned so that
+ *      all of delta_b comes before all of delta_f, each group keeping its
+ *      relative order. Nothing outside the affected region moves.
+ *
+ * Deleting an edge can never invalidate a topological order, so deletions
+ * only update the adjacency lists.
+ *
+ * Time Complexity:
+ *   add_edge:    O(|delta| log |delta| + edges of delta), often O(1)
+ *   remove_edge: O(out-degree + in-degree)
+ * Space Complexity: O(V + E)
+ */
+
+#ifndef ALGOVAULT_SORTING_INCREMENTAL_TOPOLOGICAL_SORT_H
+#define ALGOVAULT_SORTING_INCREMENTAL_TOPOLOGICAL_SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+class IncrementalTopologicalOrder {
+public:
+    /**
+     * Creates a graph without edges, ordered 0, 1, ..., num_vertices - 1
+     * @param num_vertices: initial number of vertices
+     */
+    explicit IncrementalTopologicalOrder(int num_vertices = 0) {
+        for (int i = 0; i < num_vertices; i++) {
+            add_vertex();
+        }
+    }
+
+    /**
+     * Adds a vertex at the end of the order
+     * @return id of the new vertex
+     */
+    int add_vertex() {
+        int v = num_vertices();
+        out_.emplace_back();
+        in_.emplace_back();
+        ord_.push_back(v);
+        vertex_at_.push_back(v);
+        mark_.push_back(0);
+        parent_.push_back(-1);
+        return v;
+    }
+
+    /**
+     * @return number of vertices
+     */
+    int num_vertices() const { return static_cast<int>(ord_.size()); }
+
+    /**
+     * Inserts the edge u -> v and repairs the order if needed
+     *
+     * @param u: source vertex (must come first)
+     * @param v: target vertex
+     * @param cycle: optional, receives the cycle the edge would create
+     *               (edges cycle[0] -> cycle[1] -> ... -> cycle[0])
+     * @return true if inserted, false if rejected because of a cycle
+     */
+    bool add_edge(int u, int v, std::vector<int>* cycle = nullptr) {
+        if (u == v) {
+            if (cycle != nullptr) {
+                *cycle = {u};
+            }
+            return false;
+        }
+
+        const int lower = ord_[v];
+        const int upper = ord_[u];
+        if (lower < upper) {
+            next_epoch();
+            delta_f_.clear();
+            delta_b_.clear();
+
+            if (forward_search(v, upper, u)) {
+                if (cycle != nullptr) {
+                    // Path v -> ... -> u was recorded through parent_
+                    cycle->clear();
+                    for (int w = u; w != v; w = parent_[w]) {
+                        cycle->push_back(w);
+                    }
+                    cycle->push_back(v);
+                    std::reverse(cycle->begin() + 1, cycle->end());
+                }
+                return false;
+            }
+            backward_search(u, lower);
+            reorder();
+        }
+
+        out_[u].push_back(v);
+        in_[v].push_back(u);
+        return true;
+    }
+
+    /**
+     * Deletes one edge u -> v (the order stays valid)
+     * @return true if the edge existed
+     */
+    bool remove_edge(int u, int v) {
+        if (!erase_one(out_[u], v)) {
+            return false;
+        }
+        erase_one(in_[v], u);
+        return true;
+    }
+
+    /**
+     * @return current topological order (position -> vertex)
+     */
+    const std::vector<int>& order() const { return vertex_at_; }
+
+    /**
+     * @return position of vertex v in the current order
+     */
+    int position(int v) const { return ord_[v]; }
+
+private:
+    void next_epoch() {
+        if (++epoch_ == 0) {
+            std::fill(mark_.begin(), mark_.end(), 0);
+            epoch_ = 1;
+        }
+    }
+
+    /**
+     * Iterative DFS from start over vertices with ord < upper.
+     * Returns true as soon as target is reached.
+     */
+    bool forward_search(int start, int upper, int target) {
+        mark_[start] = epoch_;
+        delta_f_.push_back(start);
+        stack_.assign(1, {start, 0});
+
+        while (!stack_.empty()) {
+            const int w = stack_.back().first;
+            if (stack_.back().second == out_[w].size()) {
+                stack_.pop_back();
+                continue;
+            }
+            const int next = out_[w][stack_.back().second++];
+            if (next == target) {
+                parent_[next] = w;
+                return true;
+            }
+            if (mark_[next] != epoch_ && ord_[next] < upper) {
+                mark_[next] = epoch_;
+                parent_[next] = w;
+                delta_f_.push_back(next);
+                stack_.push_back({next, 0});
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Iterative DFS backwards from start over vertices with ord > lower
+     */
+    void backward_search(int start, int lower) {
+        mark_[start] = epoch_;
+        delta_b_.push_back(start);
+        stack_.assign(1, {start, 0});
+
+        while (!stack_.empty()) {
+            const int w = stack_.back().first;
+            if (stack_.back().second == in_[w].size()) {
+                stack_.pop_back();
+                continue;
+            }
+            const int prev = in_[w][stack_.back().second++];
+            if (mark_[prev] != epoch_ && ord_[prev] > lower) {
+                mark_[prev] = epoch_;
+                delta_b_.push_back(prev);
+                stack_.push_back({prev, 0});
+            }
+        }
+    }
+
+    /**
+     * Gives the positions of delta_b and delta_f to delta_b first, then
+     * delta_f, keeping the relative order inside each group
+     */
+    void reorder() {
+        auto by_position = [this](int a, int b) { return ord_[a] < ord_[b]; };
+        std::sort(delta_b_.begin(), delta_b_.end(), by_position);
+        std::sort(delta_f_.begin(), delta_f_.end(), by_position);
+
+        positions_.clear();
+        for (int w : delta_b_) {
+            positions_.push_back(ord_[w]);
+        }
+        for (int w : delta_f_) {
+            positions_.push_back(ord_[w]);
+        }
+        std::sort(positions_.begin(), positions_.end());
+
+        std::size_t i = 0;
+        for (int w : delta_b_) {
+            place(w, positions_[i++]);
+        }
+        for (int w : delta_f_) {
+            place(w, positions_[i++]);
+        }
+    }
+
+    void place(int v, int position) {
+        ord_[v] = position;
+        vertex_at_[position] = v;
+    }
+
+    static bool erase_one(std::vector<int>& list, int value) {
+        auto it = std::find(list.begin(), list.end(), value);
+        if (it == list.end()) {
+            return false;
+        }
+        *it = list.back();
+        list.pop_back();
+        return true;
+    }
+
+    std::vector<std::vector<int>> out_;
+    std::vector<std::vector<int>> in_;
+    std::vector<int> ord_;        // vertex -> position
+    std::vector<int> vertex_at_;  // position -> vertex
+
+    // Search state, kept between calls to avoid allocations
+    std::vector<std::uint32_t> mark_;
+    std::uint32_t epoch_ = 0;
+    std::vector<int> parent_;
+    std::vector<int> delta_f_;
+    std::vector<int> delta_b_;
+    std::vector<int> positions_;
+    std::vector<std::pair<int, std::size_t>> stack_;
+};
+
+#endif // ALGOVAULT_SORTING_INCREMENTAL_TOPOLOGICAL_SORT_H
@@ -0,0 +1,132 @@
+/*
+ * Insertion Sort (generic version)
+ *
+ * Description:
+ * Takes the elements one by one and shifts each one left until it meets
+ * an element that is not larger. Very fast for small or nearly sorted
+ * inputs, which is why faster sorts use it for their small pieces.
+ *
+ * An element smaller than the first one is moved to the front in one
+ * block move. Every other element is guaranteed to stop before the front,
+ * so the inner loop needs no "j >= 0" bounds check.
+ *
+ * Works on any random access range, with a comparator and a projection
+ * (see sort_utils.h). Equal elements keep their order (stable).
+ *
+ * Both versions are constexpr, e.g. for tables sorted at compile time.
+ * The std::array overload unrolls completely for small N: element i sinks
+ * through a fixed chain of i compare-exchanges, without loops or branches
+ * on the data for scalar types.
+ *
+ * Time Complexity: O(n^2), O(n) if already sorted
+ * Space Complexity: O(1)
+ */
+
+#ifndef ALGOVAULT_SORTING_INSERTION_SORT_H
+#define ALGOVAULT_SORTING_INSERTION_SORT_H
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include "sort_utils.h"
+
+/**
+ * Sorts [first, last) with a predicate that already includes projection
+ */
+template <typename RandomIt, typename Less>
+constexpr void insertion_sort_with(RandomIt first, RandomIt last, Less less) {
+    if (last - first <= 1) {
+        return;
+    }
+
+    for (RandomIt i = first + 1; i != last; ++i) {
+        if (less(*i, *first)) {
+            // New minimum: shift the whole sorted prefix right by one
+            auto key = std::move(*i);
+            constexpr_move_backward(first, i, i + 1);
+            *first = std::move(key);
+        } else if (less(*i, *(i - 1))) {
+            // *first is not larger than key, so the loop stops before it
+            auto key = std::move(*i);
+            RandomIt j = i;
+            do {
+                *j = std::move(*(j - 1));
+                --j;
+            } while (less(key, *(j - 1)));
+            *j = std::move(key);
+        }
+    }
+}
+
+/**
+ * Insertion sort without any front check, for pieces of a larger array
+ *
+ * Precondition: the element just before first is not larger than any
+ * element in [first, last), so it stops every shift. Quicksort partitions
+ * other than the leftmost one satisfy this (their left neighbor is a pivot).
+ */
+template <typename RandomIt, typename Less>
+constexpr void unguarded_insertion_sort_with(RandomIt first, RandomIt last, Less less) {
+    if (first == last) {
+        return;
+    }
+
+    for (RandomIt i = first + 1; i != last; ++i) {
+        if (less(*i, *(i - 1))) {
+            auto key = std::move(*i);
+            RandomIt j = i;
+            do {
+                *j = std::move(*(j - 1));
+                --j;
+            } while (less(key, *(j - 1)));
+            *j = std::move(key);
+        }
+    }
+}
+
+/**
+ * Sorts [first, last) using insertion sort
+ * @param first, last: random access range to sort
+ * @param comp: strict weak ordering on projected values
+ * @param proj: projection applied before comparing
+ */
+template <typename RandomIt, typename Compare = std::less<>, typename Projection = Identity>
+constexpr void insertion_sort(RandomIt first, RandomIt last, Compare comp = {}, Projection proj = {}) {
+    auto less = make_projected_less(std::move(comp), std::move(proj));
+    insertion_sort_with(first, last, less);
+}
+
+/**
+ * Sinks values[I] into the sorted prefix values[0 .. I):
+ * compare-exchange (I - 1, I), (I - 2, I - 1), ..., (0, 1)
+ */
+template <std::size_t I, typename T, std::size_t N, typename Less, std::size_t... J>
+constexpr void unrolled_insert(std::array<T, N>& values, Less& less, std::index_sequence<J...>) {
+    (compare_exchange(values[I - 1 - J], values[I - J], less), ...);
+}
+
+template <typename T, std::size_t N, typename Less, std::size_t... I>
+constexpr void unrolled_insertion_sort(std::array<T, N>& values, Less& less, std::index_sequence<I...>) {
+    (unrolled_insert<I + 1>(values, less, std::make_index_sequence<I + 1>()), ...);
+}
+
+/**
+ * Sorts a std::array using insertion sort, fully unrolled up to
+ * kUnrolledSortMaxSize elements
+ * @param values: array to sort
+ * @param comp: strict weak ordering on projected values
+ * @param proj: projection applied before comparing
+ */
+template <typename T, std::size_t N, typename Compare = std::less<>, typename Projection = Identity>
+constexpr void insertion_sort(std::array<T, N>& values, Compare comp = {}, Projection proj = {}) {
+    if constexpr (N > 1 && N <= kUnrolledSortMaxSize) {
+        auto less = make_projected_less(std::move(comp), std::move(proj));
+        unrolled_insertion_sort(values, less, std::make_index_sequence<N - 1>());
+    } else {
+        insertion_sort(values.begin(), values.end(), std::move(comp), std::move(proj));
+    }
+}
+
+#endif // ALGOVAULT_SORTING_INSERTION_SORT_H
@@ -1,9 +1,17 @@
+#include <algorithm>
+#include <array>
+#include <functional>
 #include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "insertion_sort.h"
 using namespace std;
 
 /*
 Insertion Sort Function
 Sorts the array in ascending order
+(the generic template version is in insertion_sort.h)
 */
 void insertionSort(int arr[], int n) {
     // Edge case: empty array or single element
@@ -11,20 +19,46 @@ void insertionSort(int arr[], int n) {
         return;
     }
 
-   
-    for (int i = 1; i < n; i++) {
-        int key = arr[i];     
-        int j = i - 1;
+    insertion_sort(arr, arr + n);
+}
 
-       
-        while (j >= 0 && arr[j] > key) {
-            arr[j + 1] = arr[j];
-            j--;
-        }
+/*
+Example record type: sorted by key without copying keys out
+*/
+struct Record {
+    int key;
+    string name;
+};
+
+/*
+Sorted copy of a fixed-size array, computed at compile time when used
+for a constant (unrolled for up to kUnrolledSortMaxSize elements)
+*/
+template <size_t N>
+constexpr array<int, N> sorted_table(array<int, N> values) {
+    insertion_sort(values);
+    return values;
+}
 
-        // Insert key at correct position
-        arr[j + 1] = key;
+/*
+Sorts random arrays of size N with the std::array overload and compares
+with std::sort
+*/
+template <size_t N>
+bool array_sort_matches_std_sort(mt19937& rng) {
+    for (int trial = 0; trial < 200; trial++) {
+        array<int, N> values{};
+        for (int& x : values) {
+            x = static_cast<int>(rng() % 8);
+        }
+        array<int, N> expected = values;
+        sort(expected.begin(), expected.end());
+        insertion_sort(values);
+        if (values != expected) {
+            return false;
+        }
     }
+    return true;
 }
 
 /*
@@ -95,10 +129,47 @@ int main() {
     cout << "\nEmpty array: ";
     printArray(empty, 0);
 
+    // Floats, descending (custom comparator)
+    vector<float> floats = {0.5f, -2.0f, 3.25f, 1.0f};
+    insertion_sort(floats.begin(), floats.end(), greater<>());
+    cout << "\nFloats, descending: ";
+    for (float f : floats) {
+        cout << f << " ";
+    }
+    cout << endl;
+
+    // Records by key (projection), equal keys keep their order
+    vector<Record> records = {{3, "c"}, {1, "a"}, {2, "b1"}, {0, "z"}, {2, "b2"}};
+    insertion_sort(records.begin(), records.end(), less<>(), &Record::key);
+    cout << "\nRecords by key: ";
+    for (const Record& r : records) {
+        cout << "(" << r.key << ", " << r.name << ") ";
+    }
+    cout << endl;
+
+    // Table sorted by the compiler
+    constexpr array<int, 6> kTable = sorted_table(array<int, 6>{40, 10, 60, 20, 50, 30});
+    static_assert(kTable[0] == 10 && kTable[5] == 60, "table sorted at compile time");
+    cout << "\nCompile-time sorted table: ";
+    for (int x : kTable) {
+        cout << x << " ";
+    }
+    cout << endl;
+
+    // std::array overload: unrolled (N <= 16) and loop sizes
+    mt19937 rng(7);
+    bool all_match = array_sort_matches_std_sort<2>(rng) && array_sort_matches_std_sort<7>(rng) &&
+                     array_sort_matches_std_sort<16>(rng) && array_sort_matches_std_sort<33>(rng);
+    cout << "\nstd::array results match std::sort: " << (all_match ? "yes" : "no") << endl;
+
     return 0;
 }
 
 /*
+Generic version (insertion_sort.h):
+- Any random access range, comparator and projection
+- Stable: equal elements keep their order
+
 Time Complexity:
 - Best Case:  O(n)   (already sorted)
 - Average:    O(n^2)
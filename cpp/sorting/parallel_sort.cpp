@@ -0,0 +1,209 @@
+/*
+ * Parallel Sort Examples
+ *
+ * Description:
+ * parallel_sort() (sample sort, unstable) and parallel_stable_sort()
+ * (merge sort, stable) from parallel_sort.h spread one sort over all cores.
+ * The vector overloads below create a pool with the requested number of
+ * threads (0 = one per core) for a single call.
+ *
+ * Time Complexity: O(n log n / p + n) for p threads
+ * Space Complexity: O(n)
+ *
+ * Usage: ./parallel_sort [elements] [max_threads]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "parallel_sort.h"
+using namespace std;
+
+/**
+ * Sorts a vector of ints using parallel sample sort
+ * @param arr: vector to be sorted (passed by reference)
+ * @param num_threads: threads to use, 0 = all cores
+ */
+void parallel_sort(vector<int>& arr, unsigned num_threads = 0) {
+    ThreadPool pool(num_threads);
+    parallel_sort(arr.begin(), arr.end(), pool);
+}
+
+/**
+ * Sorts a vector of ints using parallel merge sort, keeping equal
+ * elements in their input order
+ * @param arr: vector to be sorted (passed by reference)
+ * @param num_threads: threads to use, 0 = all cores
+ */
+void parallel_stable_sort(vector<int>& arr, unsigned num_threads = 0) {
+    ThreadPool pool(num_threads);
+    parallel_stable_sort(arr.begin(), arr.end(), pool);
+}
+
+/**
+ * Record sorted by key in the stability tests
+ */
+struct Record {
+    int key;
+    int input_position;
+};
+
+/**
+ * Prints a vector
+ * @param arr: vector to print
+ */
+void print_vector(const vector<int>& arr) {
+    cout << "[";
+    for (size_t i = 0; i < arr.size(); i++) {
+        cout << arr[i];
+        if (i < arr.size() - 1) {
+            cout << ", ";
+        }
+    }
+    cout << "]" << endl;
+}
+
+/**
+ * @return n random ints in [0, max_value]
+ */
+vector<int> make_random(size_t n, int max_value, unsigned seed) {
+    mt19937 rng(seed);
+    uniform_int_distribution<int> value(0, max_value);
+    vector<int> arr(n);
+    for (int& x : arr) {
+        x = value(rng);
+    }
+    return arr;
+}
+
+/**
+ * Times sort_fn on a copy of input (best of a few runs)
+ * @return milliseconds
+ */
+template <typename SortFn>
+double best_time_ms(const vector<int>& input, SortFn sort_fn) {
+    const int kRepetitions = 3;
+    double best_ms = numeric_limits<double>::max();
+    for (int rep = 0; rep < kRepetitions; rep++) {
+        vector<int> arr = input;
+        auto t0 = chrono::steady_clock::now();
+        sort_fn(arr);
+        auto t1 = chrono::steady_clock::now();
+        best_ms = min(best_ms, chrono::duration<double, milli>(t1 - t0).count());
+    }
+    return best_ms;
+}
+
+// Example usage and test cases
+int main(int argc, char* argv[]) {
+    cout << "=== Parallel Sort Examples ===" << endl << endl;
+
+    // Test Case 1: Small input (sorted sequentially below the size limit)
+    vector<int> arr1 = {64, 34, 25, 12, 22, 11, 90};
+    cout << "Test 1 - Small array:" << endl;
+    cout << "Before: ";
+    print_vector(arr1);
+    parallel_sort(arr1, 4);
+    cout << "After:  ";
+    print_vector(arr1);
+    cout << endl;
+
+    ThreadPool pool(4);
+
+    // Test Case 2: Different input shapes vs std::sort
+    bool all_correct = true;
+    for (int shape = 0; shape < 5; shape++) {
+        vector<int> arr = make_random(300000, shape == 1 ? 3 : 1000000000, 10 + shape);
+        if (shape == 2) {
+            sort(arr.begin(), arr.end());
+        } else if (shape == 3) {
+            sort(arr.rbegin(), arr.rend());
+        } else if (shape == 4) {
+            fill(arr.begin(), arr.end(), 7);
+        }
+        vector<int> expected = arr;
+        sort(expected.begin(), expected.end());
+
+        vector<int> unstable = arr;
+        vector<int> stable = arr;
+        parallel_sort(unstable.begin(), unstable.end(), pool);
+        parallel_stable_sort(stable.begin(), stable.end(), pool);
+        all_correct = all_correct && unstable == expected && stable == expected;
+    }
+    cout << "Test 2 - Random, 4 values, sorted, reversed, all equal (300000 each):" << endl;
+    cout << "All sorted correctly: " << (all_correct ? "yes" : "no") << endl << endl;
+
+    // Test Case 3: Records with duplicate keys, descending by key
+    vector<int> keys = make_random(200000, 1000, 3);
+    vector<Record> records(keys.size());
+    for (size_t i = 0; i < keys.size(); i++) {
+        records[i] = {keys[i], static_cast<int>(i)};
+    }
+    vector<Record> expected3 = records;
+    stable_sort(expected3.begin(), expected3.end(),
+                [](const Record& a, const Record& b) { return a.key > b.key; });
+
+    vector<Record> stable3 = records;
+    parallel_stable_sort(stable3.begin(), stable3.end(), pool, greater<>(), &Record::key);
+    bool stable_correct = equal(stable3.begin(), stable3.end(), expected3.begin(),
+                                [](const Record& a, const Record& b) {
+                                    return a.key == b.key && a.input_position == b.input_position;
+                                });
+
+    vector<Record> unstable3 = records;
+    parallel_sort(unstable3.begin(), unstable3.end(), pool, greater<>(), &Record::key);
+    bool keys_correct = equal(unstable3.begin(), unstable3.end(), expected3.begin(),
+                              [](const Record& a, const Record& b) { return a.key == b.key; });
+
+    cout << "Test 3 - 200000 records by key, descending:" << endl;
+    cout << "Stable sort kept input order: " << (stable_correct ? "yes" : "no") << endl;
+    cout << "Unstable sort keys sorted: " << (keys_correct ? "yes" : "no") << endl << endl;
+
+    // Scaling benchmark: ./parallel_sort [elements] [max_threads]
+    size_t elements = argc > 1 ? static_cast<size_t>(atoll(argv[1])) : 10000000;
+    unsigned max_threads = argc > 2 ? static_cast<unsigned>(atoi(argv[2]))
+                                    : max(1u, thread::hardware_concurrency());
+
+    cout << "Scaling benchmark (" << elements << " random ints, best of 3 runs):" << endl;
+    vector<int> input = make_random(elements, numeric_limits<int>::max(), 1);
+    cout << "  std::sort:        " << best_time_ms(input, [](vector<int>& a) {
+        sort(a.begin(), a.end());
+    }) << " ms" << endl;
+    cout << "  std::stable_sort: " << best_time_ms(input, [](vector<int>& a) {
+        stable_sort(a.begin(), a.end());
+    }) << " ms" << endl;
+
+    vector<unsigned> thread_counts;
+    for (unsigned threads = 1; threads < max_threads; threads *= 2) {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    double sample_1 = 0;
+    double merge_1 = 0;
+    for (unsigned threads : thread_counts) {
+        ThreadPool bench_pool(threads);
+        double sample_ms = best_time_ms(input, [&bench_pool](vector<int>& a) {
+            parallel_sort(a.begin(), a.end(), bench_pool);
+        });
+        double merge_ms = best_time_ms(input, [&bench_pool](vector<int>& a) {
+            parallel_stable_sort(a.begin(), a.end(), bench_pool);
+        });
+        if (threads == 1) {
+            sample_1 = sample_ms;
+            merge_1 = merge_ms;
+        }
+        cout << "  threads=" << threads
+             << "  sample sort=" << sample_ms << " ms (" << sample_1 / sample_ms << "x)"
+             << "  stable merge sort=" << merge_ms << " ms (" << merge_1 / merge_ms << "x)"
+             << endl;
+    }
+
+    return 0;
+}
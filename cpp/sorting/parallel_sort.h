@@ -0,0 +1,296 @@
+/*
+ * Parallel Sorting (sample sort and stable merge sort)
+ *
+ * Description:
+ * Two multi-threaded sorts on top of the fork-join ThreadPool:
+ *
+ * parallel_sort (unstable, sample sort):
+ *   1. A random sample of the input is sorted and every kSampleOversampling-th
+ *      sample becomes a splitter. Equal splitters are merged, and every
+ *      splitter also gets its own "equal" bucket, so inputs with few distinct
+ *      values do not end up in one huge bucket.
+ *   2. Blocks of the input are classified in parallel (binary search over
+ *      the splitters) and counted per bucket.
+ *   3. A prefix sum over (bucket, block) gives every block its private
+ *      output range per bucket, so the scatter into the buffer needs no
+ *      synchronization.
+ *   4. Buckets are sorted in parallel with pdq_sort and moved back. Equal
+ *      buckets are already sorted.
+ *
+ * parallel_stable_sort (stable, merge sort):
+ *   1. The input is cut into one run per thread, each run is sorted with
+ *      std::stable_sort.
+ *   2. Runs are merged pairwise until one run is left. Each merge is cut
+ *      into pieces of kParallelMergeGrain outputs; a binary search on the
+ *      "merge path" finds where every piece starts in both runs, so all
+ *      pieces of all merges of a round run in parallel.
+ *
+ * Both hand work out through ThreadPool::parallel_for, where idle threads
+ * take the next bucket / piece from a shared counter. Inputs below
+ * kParallelSortMinSize, or a pool of one thread, are sorted sequentially.
+ * Elements must be default constructible and movable (they are moved
+ * through a buffer of the same size as the input).
+ *
+ * Time Complexity: O(n log n / p + n) with p threads (expected, sample sort)
+ *                  O(n log n / p + n log p) (merge sort)
+ * Space Complexity: O(n)
+ */
+
+#ifndef ALGOVAULT_SORTING_PARALLEL_SORT_H
+#define ALGOVAULT_SORTING_PARALLEL_SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <utility>
+#include <vector>
+#include "../parallel/thread_pool.h"
+#include "pdq_sort.h"
+#include "sort_utils.h"
+
+// Below this size a parallel sort costs more than it saves
+const std::size_t kParallelSortMinSize = std::size_t{1} << 14;
+
+// Sample elements per bucket; more gives more even buckets
+const std::size_t kSampleOversampling = 32;
+
+// Buckets (and classification blocks) per thread, for load balancing
+const std::size_t kSampleBucketsPerThread = 4;
+
+// Output elements produced by one parallel merge task
+const std::size_t kParallelMergeGrain = std::size_t{1} << 16;
+
+// Elements moved by one task when copying between input and buffer
+const std::size_t kParallelMoveGrain = std::size_t{1} << 16;
+
+/**
+ * Sorts [first, last) using sample sort on a thread pool (not stable)
+ * @param first, last: random access range to sort
+ * @param pool: threads used for classification and bucket sorting
+ * @param comp: strict weak ordering on projected values
+ * @param proj: projection applied before comparing
+ */
+template <typename RandomIt, typename Compare = std::less<>, typename Projection = Identity>
+void parallel_sort(RandomIt first, RandomIt last, ThreadPool& pool, Compare comp = {},
+                   Projection proj = {}) {
+    using Value = typename std::iterator_traits<RandomIt>::value_type;
+    auto less = make_projected_less(std::move(comp), std::move(proj));
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    if (n < kParallelSortMinSize || pool.size() == 1) {
+        pdq_sort_with(first, last, less);
+        return;
+    }
+
+    // 1. Splitters from a sorted random sample (fixed seed: reproducible)
+    const std::size_t target_buckets = pool.size() * kSampleBucketsPerThread;
+    std::vector<Value> sample;
+    sample.reserve(target_buckets * kSampleOversampling);
+    std::minstd_rand rng(n);
+    for (std::size_t i = 0; i < target_buckets * kSampleOversampling; i++) {
+        sample.push_back(first[rng() % n]);
+    }
+    pdq_sort_with(sample.begin(), sample.end(), less);
+
+    std::vector<Value> splitters;
+    for (std::size_t i = 1; i < target_buckets; i++) {
+        const Value& candidate = sample[i * kSampleOversampling];
+        if (splitters.empty() || less(splitters.back(), candidate)) {
+            splitters.push_back(candidate);
+        }
+    }
+
+    // Bucket 2i: between splitter i - 1 and splitter i, bucket 2i + 1:
+    // equal to splitter i, bucket 2 * splitters: above the last splitter
+    const std::size_t num_buckets = 2 * splitters.size() + 1;
+    auto bucket_of = [&splitters](auto& local_less, const Value& value) {
+        const std::size_t above = static_cast<std::size_t>(
+            std::upper_bound(splitters.begin(), splitters.end(), value, local_less) -
+            splitters.begin());
+        if (above > 0 && !local_less(splitters[above - 1], value)) {
+            return 2 * above - 1;
+        }
+        return 2 * above;
+    };
+
+    // 2. Classify blocks in parallel, remembering every element's bucket
+    const std::size_t num_blocks = target_buckets;
+    const std::size_t block_size = (n + num_blocks - 1) / num_blocks;
+    std::vector<std::uint32_t> bucket(n);
+    std::vector<std::size_t> offsets(num_blocks * num_buckets, 0);
+    pool.parallel_for(0, num_blocks, 1, [&](unsigned, std::size_t lo, std::size_t hi) {
+        auto local_less = less;
+        for (std::size_t block = lo; block < hi; block++) {
+            std::size_t* counts = &offsets[block * num_buckets];
+            const std::size_t end = std::min(n, (block + 1) * block_size);
+            for (std::size_t i = block * block_size; i < end; i++) {
+                const std::size_t b = bucket_of(local_less, first[i]);
+                bucket[i] = static_cast<std::uint32_t>(b);
+                counts[b]++;
+            }
+        }
+    });
+
+    // 3. Exclusive prefix sum in (bucket, block) order
+    std::vector<std::size_t> bucket_begin(num_buckets + 1);
+    std::size_t sum = 0;
+    for (std::size_t b = 0; b < num_buckets; b++) {
+        bucket_begin[b] = sum;
+        for (std::size_t block = 0; block < num_blocks; block++) {
+            std::size_t count = offsets[block * num_buckets + b];
+            offsets[block * num_buckets + b] = sum;
+            sum += count;
+        }
+    }
+    bucket_begin[num_buckets] = n;
+
+    std::vector<Value> buffer(n);
+    pool.parallel_for(0, num_blocks, 1, [&](unsigned, std::size_t lo, std::size_t hi) {
+        for (std::size_t block = lo; block < hi; block++) {
+            std::size_t* next = &offsets[block * num_buckets];
+            const std::size_t end = std::min(n, (block + 1) * block_size);
+            for (std::size_t i = block * block_size; i < end; i++) {
+                buffer[next[bucket[i]]++] = std::move(first[i]);
+            }
+        }
+    });
+
+    // 4. Sort every bucket and move it back
+    pool.parallel_for(0, num_buckets, 1, [&](unsigned, std::size_t lo, std::size_t hi) {
+        auto local_less = less;
+        for (std::size_t b = lo; b < hi; b++) {
+            auto begin = buffer.begin() + static_cast<std::ptrdiff_t>(bucket_begin[b]);
+            auto end = buffer.begin() + static_cast<std::ptrdiff_t>(bucket_begin[b + 1]);
+            if (b % 2 == 0) {
+                pdq_sort_with(begin, end, local_less);
+            }
+            std::move(begin, end, first + static_cast<std::ptrdiff_t>(bucket_begin[b]));
+        }
+    });
+}
+
+/**
+ * Finds how many elements of a come first among the first k outputs of a
+ * stable merge of a and b (elements of a win ties)
+ */
+template <typename It, typename Less>
+std::size_t merge_path_split(It a, std::size_t a_size, It b, std::size_t b_size, std::size_t k,
+                             Less& less) {
+    std::size_t lo = k > b_size ? k - b_size : 0;
+    std::size_t hi = std::min(k, a_size);
+    while (lo < hi) {
+        const std::size_t mid = lo + (hi - lo) / 2;
+        if (!less(b[k - mid - 1], a[mid])) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * One round of parallel pairwise merging: runs [bounds[2i], bounds[2i + 1])
+ * and [bounds[2i + 1], bounds[2i + 2]) of src are merged into dst
+ * @return boundaries of the merged runs
+ */
+template <typename SrcIt, typename DstIt, typename Less>
+std::vector<std::size_t> parallel_merge_round(SrcIt src, DstIt dst,
+                                              const std::vector<std::size_t>& bounds,
+                                              ThreadPool& pool, Less less) {
+    struct MergeTask {
+        std::size_t a_begin, a_end, b_begin, b_end, out;
+    };
+
+    std::vector<MergeTask> tasks;
+    std::vector<std::size_t> merged_bounds;
+    const std::size_t runs = bounds.size() - 1;
+    for (std::size_t r = 0; r < runs; r += 2) {
+        const std::size_t a_begin = bounds[r];
+        const std::size_t b_begin = bounds[r + 1];
+        const std::size_t b_end = r + 1 < runs ? bounds[r + 2] : b_begin;
+        const std::size_t a_size = b_begin - a_begin;
+        const std::size_t b_size = b_end - b_begin;
+        merged_bounds.push_back(a_begin);
+
+        // Cut the merged output into pieces and find where each starts
+        std::size_t prev_a = 0;
+        for (std::size_t k = 0; k < a_size + b_size; k += kParallelMergeGrain) {
+            const std::size_t next_k = std::min(a_size + b_size, k + kParallelMergeGrain);
+            const std::size_t next_a = merge_path_split(src + a_begin, a_size, src + b_begin,
+                                                        b_size, next_k, less);
+            tasks.push_back({a_begin + prev_a, a_begin + next_a, b_begin + (k - prev_a),
+                             b_begin + (next_k - next_a), a_begin + k});
+            prev_a = next_a;
+        }
+    }
+    merged_bounds.push_back(bounds.back());
+
+    pool.parallel_for(0, tasks.size(), 1, [&](unsigned, std::size_t lo, std::size_t hi) {
+        auto local_less = less;
+        for (std::size_t t = lo; t < hi; t++) {
+            const MergeTask& task = tasks[t];
+            std::merge(std::make_move_iterator(src + task.a_begin),
+                       std::make_move_iterator(src + task.a_end),
+                       std::make_move_iterator(src + task.b_begin),
+                       std::make_move_iterator(src + task.b_end), dst + task.out, local_less);
+        }
+    });
+    return merged_bounds;
+}
+
+/**
+ * Sorts [first, last) using parallel merge sort (stable)
+ * @param first, last: random access range to sort
+ * @param pool: threads used for run sorting and merging
+ * @param comp: strict weak ordering on projected values
+ * @param proj: projection applied before comparing
+ */
+template <typename RandomIt, typename Compare = std::less<>, typename Projection = Identity>
+void parallel_stable_sort(RandomIt first, RandomIt last, ThreadPool& pool, Compare comp = {},
+                          Projection proj = {}) {
+    using Value = typename std::iterator_traits<RandomIt>::value_type;
+    auto less = make_projected_less(std::move(comp), std::move(proj));
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    if (n < kParallelSortMinSize || pool.size() == 1) {
+        std::stable_sort(first, last, less);
+        return;
+    }
+
+    // 1. One sorted run per thread
+    const std::size_t runs = pool.size();
+    std::vector<std::size_t> bounds(runs + 1);
+    for (std::size_t r = 0; r <= runs; r++) {
+        bounds[r] = n * r / runs;
+    }
+    pool.parallel_for(0, runs, 1, [&](unsigned, std::size_t lo, std::size_t hi) {
+        for (std::size_t r = lo; r < hi; r++) {
+            std::stable_sort(first + static_cast<std::ptrdiff_t>(bounds[r]),
+                             first + static_cast<std::ptrdiff_t>(bounds[r + 1]), less);
+        }
+    });
+
+    // 2. Merge rounds, ping-ponging between the input and a buffer
+    std::vector<Value> buffer(n);
+    bool in_buffer = false;
+    while (bounds.size() > 2) {
+        if (in_buffer) {
+            bounds = parallel_merge_round(buffer.begin(), first, bounds, pool, less);
+        } else {
+            bounds = parallel_merge_round(first, buffer.begin(), bounds, pool, less);
+        }
+        in_buffer = !in_buffer;
+    }
+
+    if (in_buffer) {
+        pool.parallel_for(0, n, kParallelMoveGrain, [&](unsigned, std::size_t lo, std::size_t hi) {
+            std::move(buffer.begin() + static_cast<std::ptrdiff_t>(lo),
+                      buffer.begin() + static_cast<std::ptrdiff_t>(hi),
+                      first + static_cast<std::ptrdiff_t>(lo));
+        });
+    }
+}
+
+#endif // ALGOVAULT_SORTING_PARALLEL_SORT_H
@@ -0,0 +1,150 @@
+/*
+ * Parallel Topological Sort (Kahn's Algorithm, wave by wave)
+ *
+ * Description:
+ * Kahn's algorithm repeatedly removes vertices whose in-degree is zero.
+ * All vertices that become ready at the same time form a "wave": wave 0 is
+ * every vertex without dependencies, wave k holds the vertices whose last
+ * dependency is in wave k - 1. Vertices of one wave never depend on each
+ * other, so each wave can be processed in parallel, and the wave index is
+ * exactly the earliest step at which a job can be scheduled.
+ *
+ *   1. In-degrees are a histogram of the neighbor array, computed by many
+ *      threads with atomic increments.
+ *   2. Each wave is split across the thread pool. Threads decrement the
+ *      in-degree of every successor atomically; the thread that brings it to
+ *      zero appends the successor to its local buffer for the next wave.
+ *   3. Local buffers are concatenated to form the next wave.
+ *
+ * The concatenated waves form a valid topological order. Vertices inside a
+ * wave may appear in a different order from run to run when several threads
+ * are used; the wave index of every vertex is always the same.
+ *
+ * The graph is a CSRGraph or a CSRGraphView (e.g. a memory-mapped graph
+ * file, see graph_file.h), like topological_sort() in topological_sort.h.
+ *
+ * Time Complexity: O(V + E) work, O(W) synchronization rounds
+ *   where W is the number of waves (longest dependency chain)
+ * Space Complexity: O(V)
+ */
+
+#ifndef ALGOVAULT_SORTING_PARALLEL_TOPOLOGICAL_SORT_H
+#define ALGOVAULT_SORTING_PARALLEL_TOPOLOGICAL_SORT_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+#include "../graph/csr_graph.h"
+#include "../graph/find_cycle.h"
+#include "../parallel/thread_pool.h"
+
+// Chunk of the neighbor array counted by one thread at a time
+const std::size_t kTopologicalEdgeGrain = 1 << 16;
+
+// Chunk of a wave processed by one thread at a time
+const std::size_t kTopologicalWaveGrain = 256;
+
+/**
+ * Result of a wave-by-wave topological sort
+ * - order: topological order, wave after wave
+ * - wave: wave index of every vertex
+ * - wave_offsets: wave k is order[wave_offsets[k]] .. order[wave_offsets[k + 1] - 1]
+ */
+template <typename VertexId>
+struct TopologicalWaves {
+    std::vector<VertexId> order;
+    std::vector<VertexId> wave;
+    std::vector<std::size_t> wave_offsets;
+};
+
+/**
+ * Performs topological sort on a directed graph using a thread pool
+ *
+ * @param graph: directed CSRGraph or CSRGraphView
+ * @param pool: thread pool used for counting and for every wave
+ * @param cycle: optional, receives the vertices of one cycle if the graph
+ *               is not a DAG
+ * @return order, wave index per vertex and wave boundaries;
+ *         empty if the graph contains a cycle
+ */
+template <typename Graph>
+TopologicalWaves<GraphVertexId<Graph>> parallel_topological_sort(const Graph& graph, ThreadPool& pool,
+                                                                 std::vector<GraphVertexId<Graph>>* cycle = nullptr) {
+    using VertexId = GraphVertexId<Graph>;
+    const std::size_t V = static_cast<std::size_t>(graph.num_vertices());
+    const auto& targets = graph.neighbor_array();
+
+    // In-degree histogram with atomic counters
+    std::vector<std::atomic<VertexId>> indegree(V);
+    pool.parallel_for(0, V, kTopologicalEdgeGrain, [&](unsigned, std::size_t lo, std::size_t hi) {
+        for (std::size_t v = lo; v < hi; v++) {
+            indegree[v].store(0, std::memory_order_relaxed);
+        }
+    });
+    pool.parallel_for(0, targets.size(), kTopologicalEdgeGrain, [&](unsigned, std::size_t lo, std::size_t hi) {
+        for (std::size_t e = lo; e < hi; e++) {
+            indegree[targets[e]].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    TopologicalWaves<VertexId> result;
+    result.order.resize(V);
+    result.wave.assign(V, -1);
+
+    // Wave 0: every vertex without dependencies
+    std::size_t size = 0;
+    for (std::size_t v = 0; v < V; v++) {
+        if (indegree[v].load(std::memory_order_relaxed) == 0) {
+            result.order[size++] = static_cast<VertexId>(v);
+        }
+    }
+
+    std::vector<std::vector<VertexId>> local_next(pool.size());
+    std::size_t wave_begin = 0;
+    VertexId wave = 0;
+
+    while (wave_begin < size) {
+        const std::size_t wave_end = size;
+        result.wave_offsets.push_back(wave_begin);
+
+        pool.parallel_for(wave_begin, wave_end, kTopologicalWaveGrain,
+                          [&](unsigned thread, std::size_t lo, std::size_t hi) {
+            std::vector<VertexId>& out = local_next[thread];
+            for (std::size_t i = lo; i < hi; i++) {
+                const VertexId node = result.order[i];
+                result.wave[node] = wave;
+                for (VertexId neighbor : graph.neighbors(node)) {
+                    // acq_rel: the last decrement sees every earlier one
+                    if (indegree[neighbor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                        out.push_back(neighbor);
+                    }
+                }
+            }
+        });
+
+        // Concatenate the thread-local buffers into the next wave
+        for (std::vector<VertexId>& buffer : local_next) {
+            for (VertexId v : buffer) {
+                result.order[size++] = v;
+            }
+            buffer.clear();
+        }
+
+        wave_begin = wave_end;
+        wave++;
+    }
+
+    // Cycle detection
+    if (size != V) {
+        if (cycle != nullptr) {
+            *cycle = find_cycle(graph.num_vertices(),
+                                [&](VertexId u) { return graph.neighbors(u); });
+        }
+        return {};
+    }
+
+    result.wave_offsets.push_back(V);
+    return result;
+}
+
+#endif // ALGOVAULT_SORTING_PARALLEL_TOPOLOGICAL_SORT_H
@@ -0,0 +1,148 @@
+/*
+ * Pattern-Defeating Quicksort (pdqsort) Examples
+ *
+ * Description:
+ * pdq_sort() (see pdq_sort.h) is an O(n log n) quicksort hybrid that uses
+ * insertion sort for small partitions, finishes sorted or reversed input in
+ * O(n), handles many duplicates efficiently and falls back to heapsort when
+ * pivots keep going wrong.
+ *
+ * Time Complexity: O(n log n) worst case, O(n) best case
+ * Space Complexity: O(log n)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "pdq_sort.h"
+using namespace std;
+
+/**
+ * Sorts a vector of ints using pdqsort
+ * @param arr: vector to be sorted (passed by reference)
+ */
+void pdq_sort(vector<int>& arr) {
+    pdq_sort(arr.begin(), arr.end());
+}
+
+/**
+ * Prints a vector
+ * @param arr: vector to print
+ */
+void print_vector(const vector<int>& arr) {
+    cout << "[";
+    for (size_t i = 0; i < arr.size(); i++) {
+        cout << arr[i];
+        if (i < arr.size() - 1) {
+            cout << ", ";
+        }
+    }
+    cout << "]" << endl;
+}
+
+/**
+ * Generates test inputs of different shapes
+ */
+vector<int> make_input(const string& shape, size_t n, mt19937& rng) {
+    vector<int> arr(n);
+    for (size_t i = 0; i < n; i++) {
+        arr[i] = static_cast<int>(rng());
+    }
+    if (shape == "sorted") {
+        sort(arr.begin(), arr.end());
+    } else if (shape == "reversed") {
+        sort(arr.begin(), arr.end(), greater<int>());
+    } else if (shape == "few unique") {
+        for (int& x : arr) {
+            x &= 7;
+        }
+    } else if (shape == "organ pipe") {
+        for (size_t i = 0; i < n; i++) {
+            arr[i] = static_cast<int>(min(i, n - i));
+        }
+    } else if (shape == "sorted + noise") {
+        sort(arr.begin(), arr.end());
+        for (size_t k = 0; k < n / 100; k++) {
+            swap(arr[rng() % n], arr[rng() % n]);
+        }
+    }
+    return arr;
+}
+
+// Example usage and test cases
+int main() {
+    cout << "=== Pattern-Defeating Quicksort Examples ===" << endl << endl;
+
+    // Test Cases 1-6: same inputs as bubble_sort.cpp
+    vector<vector<int>> cases = {
+        {64, 34, 25, 12, 22, 11, 90},
+        {1, 2, 3, 4, 5},
+        {5, 4, 3, 2, 1},
+        {42},
+        {},
+        {3, 5, 1, 3, 2, 5, 1}
+    };
+    vector<string> names = {"Normal case", "Already sorted", "Reverse sorted",
+                            "Single element", "Empty array", "Duplicate elements"};
+    for (size_t t = 0; t < cases.size(); t++) {
+        cout << "Test " << t + 1 << " - " << names[t] << ":" << endl;
+        cout << "Before: ";
+        print_vector(cases[t]);
+        pdq_sort(cases[t]);
+        cout << "After:  ";
+        print_vector(cases[t]);
+        cout << endl;
+    }
+
+    // Test Case 7: Input shapes that break naive quicksorts, checked
+    // against std::sort for many sizes
+    cout << "Test 7 - Many shapes and sizes vs std::sort:" << endl;
+    mt19937 rng(2024);
+    vector<string> shapes = {"random", "sorted", "reversed", "few unique",
+                             "organ pipe", "sorted + noise"};
+    bool all_correct = true;
+    for (const string& shape : shapes) {
+        for (size_t n : {0, 1, 2, 3, 23, 24, 25, 127, 129, 1000, 5000}) {
+            vector<int> arr = make_input(shape, n, rng);
+            vector<int> expected = arr;
+            sort(expected.begin(), expected.end());
+            pdq_sort(arr);
+            all_correct = all_correct && arr == expected;
+        }
+    }
+    cout << "All sorted correctly: " << (all_correct ? "yes" : "no") << endl << endl;
+
+    // Test Case 8: Descending order of strings (comparator)
+    vector<string> words = {"pear", "apple", "fig", "banana", "cherry"};
+    pdq_sort(words.begin(), words.end(), greater<>());
+    cout << "Test 8 - Strings, descending:" << endl;
+    for (const string& w : words) {
+        cout << w << " ";
+    }
+    cout << endl << endl;
+
+    // Test Case 9: Timing against std::sort on 1M ints
+    const size_t kSize = 1000000;
+    cout << "Test 9 - " << kSize << " ints, pdq_sort vs std::sort:" << endl;
+    for (const string& shape : shapes) {
+        vector<int> a = make_input(shape, kSize, rng);
+        vector<int> b = a;
+
+        auto t0 = chrono::steady_clock::now();
+        pdq_sort(a);
+        auto t1 = chrono::steady_clock::now();
+        sort(b.begin(), b.end());
+        auto t2 = chrono::steady_clock::now();
+
+        cout << "  " << shape << ": pdq_sort "
+             << chrono::duration<double, milli>(t1 - t0).count() << " ms, std::sort "
+             << chrono::duration<double, milli>(t2 - t1).count() << " ms"
+             << (a == b ? "" : "  (WRONG RESULT)") << endl;
+    }
+
+    return 0;
+}
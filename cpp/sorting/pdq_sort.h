@@ -0,0 +1,314 @@
+/*
+ * Pattern-Defeating Quicksort (pdqsort)
+ *
+ * Description:
+ * An introsort-style hybrid built from the sorts in this folder:
+ *
+ *   - Quicksort does the bulk of the work. The pivot is the median of
+ *     3 elements (or the median of 3 medians for large partitions).
+ *   - Partitions smaller than kPdqInsertionThreshold are finished by
+ *     insertion sort (insertion_sort.h). Every partition except the
+ *     leftmost has a pivot on its left, so it uses the unguarded variant.
+ *     Arithmetic elements instead go to a branchless sorting network as
+ *     soon as a partition fits one (kSortingNetworkMaxSize, see
+ *     sorting_network.h).
+ *   - Sorted and reverse-sorted inputs are detected up front and finished
+ *     in O(n). A partition step that moved nothing also triggers a bounded
+ *     insertion sort attempt, which completes nearly-sorted pieces early.
+ *   - Many equal elements: when the pivot equals the element just left of
+ *     the partition, all elements equal to it are grouped and skipped,
+ *     so inputs with few distinct values run in O(n * distinct values).
+ *   - Bad pivots: a highly unbalanced split shuffles a few elements to
+ *     break the pattern. After log2(n) bad splits the partition falls back
+ *     to heapsort, which bounds the worst case to O(n log n).
+ *
+ * The sort recurses into the smaller side and loops on the larger one, so
+ * the stack depth is O(log n). Like std::sort it is not stable.
+ *
+ * Time Complexity: O(n log n) worst case, O(n) for sorted/reversed input
+ * Space Complexity: O(log n) stack
+ */
+
+#ifndef ALGOVAULT_SORTING_PDQ_SORT_H
+#define ALGOVAULT_SORTING_PDQ_SORT_H
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include "insertion_sort.h"
+#include "sort_utils.h"
+#include "sorting_network.h"
+#include "../profiling/perf_counters.h"
+
+// Partitions below this size are finished with insertion sort
+const long kPdqInsertionThreshold = 24;
+
+// Partitions above this size use the median of 3 medians as pivot
+const long kPdqNintherThreshold = 128;
+
+// Element moves allowed before a partial insertion sort gives up
+const long kPdqPartialInsertionLimit = 8;
+
+/**
+ * Orders *a and *b
+ */
+template <typename RandomIt, typename Less>
+void pdq_sort2(RandomIt a, RandomIt b, Less& less) {
+    if (less(*b, *a)) {
+        std::iter_swap(a, b);
+    }
+}
+
+/**
+ * Orders *a, *b and *c (the median ends up in *b)
+ */
+template <typename RandomIt, typename Less>
+void pdq_sort3(RandomIt a, RandomIt b, RandomIt c, Less& less) {
+    pdq_sort2(a, b, less);
+    pdq_sort2(b, c, less);
+    pdq_sort2(a, b, less);
+}
+
+/**
+ * Insertion sort that gives up after kPdqPartialInsertionLimit moves
+ * @return true if [first, last) is now sorted
+ */
+template <typename RandomIt, typename Less>
+bool pdq_partial_insertion_sort(RandomIt first, RandomIt last, Less& less) {
+    if (first == last) {
+        return true;
+    }
+
+    long moves = 0;
+    for (RandomIt i = first + 1; i != last; ++i) {
+        if (less(*i, *(i - 1))) {
+            auto key = std::move(*i);
+            RandomIt j = i;
+            do {
+                *j = std::move(*(j - 1));
+                --j;
+            } while (j != first && less(key, *(j - 1)));
+            *j = std::move(key);
+            moves += i - j;
+        }
+        if (moves > kPdqPartialInsertionLimit) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Partitions around the pivot *first: smaller elements to the left,
+ * elements not smaller to the right
+ * @return final pivot position and whether no element had to move
+ */
+template <typename RandomIt, typename Less>
+std::pair<RandomIt, bool> pdq_partition_right(RandomIt first, RandomIt last, Less& less) {
+    auto pivot = std::move(*first);
+    RandomIt left = first;
+    RandomIt right = last;
+
+    // The median-of-3 guarantees an element >= pivot exists on the right
+    while (less(*++left, pivot)) {
+    }
+    if (left - 1 == first) {
+        while (left < right && !less(*--right, pivot)) {
+        }
+    } else {
+        while (!less(*--right, pivot)) {
+        }
+    }
+
+    const bool already_partitioned = left >= right;
+    while (left < right) {
+        std::iter_swap(left, right);
+        while (less(*++left, pivot)) {
+        }
+        while (!less(*--right, pivot)) {
+        }
+    }
+
+    RandomIt pivot_pos = left - 1;
+    *first = std::move(*pivot_pos);
+    *pivot_pos = std::move(pivot);
+    return {pivot_pos, already_partitioned};
+}
+
+/**
+ * Partitions around the pivot *first putting elements EQUAL to it on the
+ * left. Used when the pivot equals the element before the partition, i.e.
+ * every element on the left side will be equal and needs no more sorting.
+ * @return final pivot position
+ */
+template <typename RandomIt, typename Less>
+RandomIt pdq_partition_left(RandomIt first, RandomIt last, Less& less) {
+    auto pivot = std::move(*first);
+    RandomIt left = first;
+    RandomIt right = last;
+
+    while (less(pivot, *--right)) {
+    }
+    if (right + 1 == last) {
+        while (left < right && !less(pivot, *++left)) {
+        }
+    } else {
+        while (!less(pivot, *++left)) {
+        }
+    }
+
+    while (left < right) {
+        std::iter_swap(left, right);
+        while (less(pivot, *--right)) {
+        }
+        while (!less(pivot, *++left)) {
+        }
+    }
+
+    RandomIt pivot_pos = right;
+    *first = std::move(*pivot_pos);
+    *pivot_pos = std::move(pivot);
+    return pivot_pos;
+}
+
+/**
+ * Swaps a few elements of an unbalanced partition to break patterns
+ */
+template <typename RandomIt>
+void pdq_break_patterns(RandomIt first, RandomIt last) {
+    const auto size = last - first;
+    if (size < kPdqInsertionThreshold) {
+        return;
+    }
+    const auto quarter = size / 4;
+    std::iter_swap(first, first + quarter);
+    std::iter_swap(last - 1, last - quarter);
+    if (size > kPdqNintherThreshold) {
+        std::iter_swap(first + 1, first + (quarter + 1));
+        std::iter_swap(first + 2, first + (quarter + 2));
+        std::iter_swap(last - 2, last - (quarter + 1));
+        std::iter_swap(last - 3, last - (quarter + 2));
+    }
+}
+
+/**
+ * Main pdqsort loop on [first, last)
+ * @param bad_allowed: unbalanced partitions left before heapsort
+ * @param leftmost: true if no pivot lies to the left of first
+ */
+template <typename RandomIt, typename Less>
+void pdq_sort_loop(RandomIt first, RandomIt last, Less& less, int bad_allowed, bool leftmost) {
+    while (true) {
+        const auto size = last - first;
+
+        if constexpr (use_sorting_network<typename std::iterator_traits<RandomIt>::value_type>::value) {
+            if (size <= static_cast<long>(kSortingNetworkMaxSize)) {
+                small_sort_with(first, last, less);
+                return;
+            }
+        } else if (size < kPdqInsertionThreshold) {
+            if (leftmost) {
+                insertion_sort_with(first, last, less);
+            } else {
+                unguarded_insertion_sort_with(first, last, less);
+            }
+            return;
+        }
+
+        // Pivot selection: median of 3, or pseudo median of 9 (ninther)
+        const auto half = size / 2;
+        if (size > kPdqNintherThreshold) {
+            pdq_sort3(first, first + half, last - 1, less);
+            pdq_sort3(first + 1, first + (half - 1), last - 2, less);
+            pdq_sort3(first + 2, first + (half + 1), last - 3, less);
+            pdq_sort3(first + (half - 1), first + half, first + (half + 1), less);
+            std::iter_swap(first, first + half);
+        } else {
+            pdq_sort3(first + half, first, last - 1, less);
+        }
+
+        // Pivot equal to the previous pivot: skip the run of equal elements
+        if (!leftmost && !less(*(first - 1), *first)) {
+            first = pdq_partition_left(first, last, less) + 1;
+            continue;
+        }
+
+        std::pair<RandomIt, bool> split = pdq_partition_right(first, last, less);
+        RandomIt pivot_pos = split.first;
+        const auto left_size = pivot_pos - first;
+        const auto right_size = last - (pivot_pos + 1);
+
+        if (left_size < size / 8 || right_size < size / 8) {
+            if (--bad_allowed == 0) {
+                std::make_heap(first, last, less);
+                std::sort_heap(first, last, less);
+                return;
+            }
+            pdq_break_patterns(first, pivot_pos);
+            pdq_break_patterns(pivot_pos + 1, last);
+        } else if (split.second &&
+                   pdq_partial_insertion_sort(first, pivot_pos, less) &&
+                   pdq_partial_insertion_sort(pivot_pos + 1, last, less)) {
+            // Nothing moved and both sides were nearly sorted: done
+            return;
+        }
+
+        // Recurse into the smaller side, loop on the larger one
+        if (left_size < right_size) {
+            pdq_sort_loop(first, pivot_pos, less, bad_allowed, leftmost);
+            first = pivot_pos + 1;
+            leftmost = false;
+        } else {
+            pdq_sort_loop(pivot_pos + 1, last, less, bad_allowed, false);
+            last = pivot_pos;
+        }
+    }
+}
+
+/**
+ * Sorts [first, last) with an already built predicate (see
+ * make_projected_less). Callers that hold a projected predicate use this
+ * instead of pdq_sort, which would wrap it a second time and hide the
+ * default order from the sorting network dispatch.
+ */
+template <typename RandomIt, typename Less>
+void pdq_sort_with(RandomIt first, RandomIt last, Less& less) {
+    const auto size = last - first;
+    if (size < 2) {
+        return;
+    }
+
+    // Whole input already sorted or reversed: O(n), stops at the first
+    // out-of-order pair otherwise
+    ALGOVAULT_PERF_SCOPE("pdq_sort/presorted_check");
+    if (std::is_sorted(first, last, less)) {
+        return;
+    }
+    auto greater = [&less](const auto& a, const auto& b) { return less(b, a); };
+    if (std::is_sorted(first, last, greater)) {
+        std::reverse(first, last);
+        return;
+    }
+
+    ALGOVAULT_PERF_NEXT("pdq_sort/partition_loop");
+    int log2_size = 0;
+    for (auto n = size; n > 1; n >>= 1) {
+        log2_size++;
+    }
+    pdq_sort_loop(first, last, less, log2_size, true);
+}
+
+/**
+ * Sorts [first, last) using pattern-defeating quicksort
+ * @param first, last: random access range to sort
+ * @param comp: strict weak ordering on projected values
+ * @param proj: projection applied before comparing
+ */
+template <typename RandomIt, typename Compare = std::less<>, typename Projection = Identity>
+void pdq_sort(RandomIt first, RandomIt last, Compare comp = {}, Projection proj = {}) {
+    auto less = make_projected_less(std::move(comp), std::move(proj));
+    pdq_sort_with(first, last, less);
+}
+
+#endif // ALGOVAULT_SORTING_PDQ_SORT_H
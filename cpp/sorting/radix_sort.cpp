@@ -0,0 +1,160 @@
+/*
+ * LSD Radix Sort Examples
+ *
+ * Description:
+ * radix_sort() (see radix_sort.h) sorts integer keys digit by digit with
+ * counting sort passes instead of comparisons. For large arrays of 32-bit
+ * or 64-bit keys it beats every comparison sort in this folder.
+ *
+ * Time Complexity: O(p * n) for p digit passes (3 for 32-bit keys)
+ * Space Complexity: O(n)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "pdq_sort.h"
+#include "radix_sort.h"
+using namespace std;
+
+/**
+ * Sorts a vector of ints using LSD radix sort
+ * @param arr: vector to be sorted (passed by reference)
+ */
+void radix_sort(vector<int>& arr) {
+    radix_sort(arr.begin(), arr.end());
+}
+
+/**
+ * Prints a vector
+ * @param arr: vector to print
+ */
+template <typename T>
+void print_vector(const vector<T>& arr) {
+    cout << "[";
+    for (size_t i = 0; i < arr.size(); i++) {
+        cout << arr[i];
+        if (i < arr.size() - 1) {
+            cout << ", ";
+        }
+    }
+    cout << "]" << endl;
+}
+
+/**
+ * Times one sort function on a copy of the input
+ * @return milliseconds, and whether the result matched expected
+ */
+template <typename T, typename SortFn>
+pair<double, bool> time_sort(const vector<T>& input, const vector<T>& expected, SortFn sort_fn) {
+    vector<T> arr = input;
+    auto t0 = chrono::steady_clock::now();
+    sort_fn(arr);
+    auto t1 = chrono::steady_clock::now();
+    return {chrono::duration<double, milli>(t1 - t0).count(), arr == expected};
+}
+
+// Example usage and test cases
+int main() {
+    cout << "=== LSD Radix Sort Examples ===" << endl << endl;
+
+    // Test Case 1: Signed ints with negatives and extremes
+    vector<int> arr1 = {64, -34, 25, numeric_limits<int>::min(), 0, -1,
+                        numeric_limits<int>::max(), 11, -90};
+    cout << "Test 1 - Signed ints:" << endl;
+    cout << "Before: ";
+    print_vector(arr1);
+    radix_sort(arr1);
+    cout << "After:  ";
+    print_vector(arr1);
+    cout << endl;
+
+    // Test Case 2: Empty and single element
+    vector<int> arr2 = {};
+    vector<int> arr3 = {42};
+    radix_sort(arr2);
+    radix_sort(arr3);
+    cout << "Test 2 - Empty and single element:" << endl;
+    print_vector(arr2);
+    print_vector(arr3);
+    cout << endl;
+
+    mt19937_64 rng(99);
+
+    // Test Case 3: Random keys of every supported width vs std::sort,
+    // on both sides of the 8-bit / 11-bit digit switch
+    bool all_correct = true;
+    for (size_t n : {size_t{63}, size_t{64}, size_t{1000}, size_t{100000}}) {
+        vector<int32_t> a32(n);
+        vector<uint32_t> u32(n);
+        vector<int64_t> a64(n);
+        vector<uint64_t> u64(n);
+        for (size_t i = 0; i < n; i++) {
+            uint64_t r = rng();
+            a32[i] = static_cast<int32_t>(r);
+            u32[i] = static_cast<uint32_t>(r >> 7);
+            a64[i] = static_cast<int64_t>(r);
+            u64[i] = r * 31;
+        }
+        auto check = [&all_correct](auto arr) {
+            auto expected = arr;
+            sort(expected.begin(), expected.end());
+            radix_sort(arr.begin(), arr.end());
+            all_correct = all_correct && arr == expected;
+        };
+        check(a32);
+        check(u32);
+        check(a64);
+        check(u64);
+    }
+    cout << "Test 3 - int32/uint32/int64/uint64 vs std::sort:" << endl;
+    cout << "All sorted correctly: " << (all_correct ? "yes" : "no") << endl << endl;
+
+    // Test Case 4: Key-value pairs, equal keys keep their order (stable)
+    vector<pair<uint64_t, string>> pairs = {
+        {3, "c"}, {1, "a1"}, {2, "b"}, {1, "a2"}, {0, "z"}, {1, "a3"}
+    };
+    radix_sort(pairs.begin(), pairs.end(), &pair<uint64_t, string>::first);
+    cout << "Test 4 - Key-value pairs (stable):" << endl;
+    for (const auto& p : pairs) {
+        cout << "(" << p.first << ", " << p.second << ") ";
+    }
+    cout << endl << endl;
+
+    // Test Case 5: Small values in 64-bit keys: constant high digits are skipped
+    vector<int64_t> small_values(200000);
+    for (int64_t& x : small_values) {
+        x = static_cast<int64_t>(rng() % 1000);
+    }
+    vector<int64_t> small_sorted = small_values;
+    sort(small_sorted.begin(), small_sorted.end());
+    auto small_time = time_sort(small_values, small_sorted,
+                                [](vector<int64_t>& a) { radix_sort(a.begin(), a.end()); });
+    cout << "Test 5 - 64-bit keys below 1000 (4 of 6 passes skipped):" << endl;
+    cout << "Sorted correctly: " << (small_time.second ? "yes" : "no") << endl << endl;
+
+    // Test Case 6: 10M random ints, radix vs comparison sorts
+    const size_t kSize = 10000000;
+    vector<int> big(kSize);
+    for (int& x : big) {
+        x = static_cast<int>(rng());
+    }
+    vector<int> expected = big;
+    sort(expected.begin(), expected.end());
+
+    cout << "Test 6 - " << kSize << " random ints:" << endl;
+    auto radix = time_sort(big, expected, [](vector<int>& a) { radix_sort(a); });
+    auto pdq = time_sort(big, expected, [](vector<int>& a) { pdq_sort(a.begin(), a.end()); });
+    auto std_sort = time_sort(big, expected, [](vector<int>& a) { sort(a.begin(), a.end()); });
+    cout << "  radix_sort: " << radix.first << " ms" << (radix.second ? "" : " (WRONG RESULT)") << endl;
+    cout << "  pdq_sort:   " << pdq.first << " ms" << (pdq.second ? "" : " (WRONG RESULT)") << endl;
+    cout << "  std::sort:  " << std_sort.first << " ms" << endl;
+
+    return 0;
+}
@@ -0,0 +1,155 @@
+/*
+ * LSD Radix Sort for integer keys
+ *
+ * Description:
+ * Least significant digit (LSD) radix sort does not compare elements. It
+ * splits every key into digits and, starting with the lowest digit, does a
+ * stable counting sort (histogram + prefix sum + scatter) per digit. After
+ * the last digit the array is sorted.
+ *
+ *   - Keys: any integer type (int32_t, uint32_t, int64_t, uint64_t, ...).
+ *     Signed keys are handled by flipping the sign bit, which maps them to
+ *     unsigned values in the same order.
+ *   - Digits are 8 bits for small inputs and 11 bits for large ones
+ *     (3 passes instead of 4 for 32-bit keys, 6 instead of 8 for 64-bit);
+ *     an 11-bit histogram (2048 counters) still fits in L1 cache.
+ *   - All histograms are built in a single read pass. A digit that is the
+ *     same for every key (e.g. the high bytes of small numbers) is skipped.
+ *   - Records and key-value pairs are sorted through a projection that
+ *     returns the key, e.g. &std::pair<uint64_t, int>::first.
+ *   - Inputs below kRadixInsertionThreshold use insertion sort, or for
+ *     plain integer keys small_sort (a sorting network up to 32 elements,
+ *     see sorting_network.h).
+ *
+ * The sort is stable: equal keys keep their input order. Elements must be
+ * default constructible and movable (they are moved through a buffer).
+ *
+ * Time Complexity: O(p * (n + 2^b)) for p digits of b bits
+ * Space Complexity: O(n) buffer + O(p * 2^b) histograms
+ */
+
+#ifndef ALGOVAULT_SORTING_RADIX_SORT_H
+#define ALGOVAULT_SORTING_RADIX_SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "insertion_sort.h"
+#include "sort_utils.h"
+#include "sorting_network.h"
+#include "../profiling/perf_counters.h"
+
+// Below this size insertion sort is faster than any radix pass
+const std::size_t kRadixInsertionThreshold = 64;
+
+// From this size on 11-bit digits pay off over 8-bit digits
+const std::size_t kRadix11BitMinSize = std::size_t{1} << 16;
+
+/**
+ * Maps an integer key to an unsigned value with the same ordering
+ */
+template <typename Key>
+constexpr std::make_unsigned_t<Key> radix_key_bits(Key key) {
+    using Unsigned = std::make_unsigned_t<Key>;
+    Unsigned bits = static_cast<Unsigned>(key);
+    if (std::is_signed<Key>::value) {
+        bits ^= static_cast<Unsigned>(Unsigned{1} << (sizeof(Key) * 8 - 1));
+    }
+    return bits;
+}
+
+/**
+ * One stable counting-sort pass: moves [src, src + n) to dst by digit
+ */
+template <typename SrcIt, typename DstIt, typename Projection>
+void radix_scatter(SrcIt src, std::size_t n, DstIt dst, std::size_t* offsets,
+                   int shift, std::size_t mask, Projection& proj) {
+    for (std::size_t i = 0; i < n; i++) {
+        const auto bits = radix_key_bits(std::invoke(proj, src[i]));
+        const std::size_t digit = static_cast<std::size_t>(bits >> shift) & mask;
+        dst[offsets[digit]++] = std::move(src[i]);
+    }
+}
+
+/**
+ * Sorts [first, last) by an integer key using LSD radix sort
+ * @param first, last: random access range to sort
+ * @param proj: returns the integer key of an element (default: the element)
+ */
+template <typename RandomIt, typename Projection = Identity>
+void radix_sort(RandomIt first, RandomIt last, Projection proj = {}) {
+    using Value = typename std::iterator_traits<RandomIt>::value_type;
+    using Key = std::decay_t<std::invoke_result_t<Projection&, Value&>>;
+    static_assert(std::is_integral<Key>::value, "radix_sort needs integer keys");
+
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    if (n < kRadixInsertionThreshold) {
+        // Equal plain integers are indistinguishable, so the unstable
+        // network is fine without a projection
+        if constexpr (std::is_same<Projection, Identity>::value) {
+            small_sort(first, last);
+        } else {
+            insertion_sort(first, last, std::less<>(), proj);
+        }
+        return;
+    }
+
+    const int digit_bits = n >= kRadix11BitMinSize ? 11 : 8;
+    const int key_bits = static_cast<int>(sizeof(Key) * 8);
+    const int passes = (key_bits + digit_bits - 1) / digit_bits;
+    const std::size_t buckets = std::size_t{1} << digit_bits;
+    const std::size_t mask = buckets - 1;
+
+    // One read pass builds the histograms of all digits
+    ALGOVAULT_PERF_SCOPE("radix_sort/histogram");
+    std::vector<std::size_t> counts(static_cast<std::size_t>(passes) * buckets, 0);
+    for (RandomIt it = first; it != last; ++it) {
+        const auto bits = radix_key_bits(std::invoke(proj, *it));
+        for (int p = 0; p < passes; p++) {
+            counts[p * buckets + (static_cast<std::size_t>(bits >> (p * digit_bits)) & mask)]++;
+        }
+    }
+
+    ALGOVAULT_PERF_NEXT("radix_sort/scatter");
+    std::vector<Value> buffer;
+    bool in_buffer = false;
+
+    for (int p = 0; p < passes; p++) {
+        std::size_t* offsets = &counts[p * buckets];
+        const int shift = p * digit_bits;
+
+        // Skip digits that are equal for every key
+        const auto first_bits = radix_key_bits(std::invoke(proj, in_buffer ? buffer[0] : *first));
+        if (offsets[static_cast<std::size_t>(first_bits >> shift) & mask] == n) {
+            continue;
+        }
+
+        // Exclusive prefix sum: counts become start offsets
+        std::size_t sum = 0;
+        for (std::size_t b = 0; b < buckets; b++) {
+            std::size_t count = offsets[b];
+            offsets[b] = sum;
+            sum += count;
+        }
+
+        if (buffer.empty()) {
+            buffer.resize(n);
+        }
+        if (in_buffer) {
+            radix_scatter(buffer.begin(), n, first, offsets, shift, mask, proj);
+        } else {
+            radix_scatter(first, n, buffer.begin(), offsets, shift, mask, proj);
+        }
+        in_buffer = !in_buffer;
+    }
+
+    if (in_buffer) {
+        std::move(buffer.begin(), buffer.end(), first);
+    }
+}
+
+#endif // ALGOVAULT_SORTING_RADIX_SORT_H
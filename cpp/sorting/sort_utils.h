@@ -0,0 +1,143 @@
+/*
+ * Shared helpers for the generic sorting templates
+ *
+ * Description:
+ * Every sorter in this folder accepts, like std::ranges::sort:
+ *   - an iterator range [first, last)
+ *   - a comparator (default: std::less<>, i.e. ascending with operator<)
+ *   - a projection applied to each element before comparing
+ *     (default: Identity; a pointer to member such as &Record::key
+ *     sorts records by that field without copying keys out)
+ *
+ * Comparator and projection are template parameters, not function pointers
+ * or std::function, so each call site is compiled for its exact types. With
+ * the defaults on int the projection and comparator inline away and the
+ * generated loop is the same as a hand-written int sort.
+ *
+ * std::invoke, std::swap and std::move_backward are constexpr only from
+ * C++20, so the helpers below replace them: the simple sorters stay
+ * constexpr in C++17 and can sort std::array lookup tables at compile time.
+ */
+
+#ifndef ALGOVAULT_SORTING_SORT_UTILS_H
+#define ALGOVAULT_SORTING_SORT_UTILS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+// Largest std::array that the array overloads sort with a fully unrolled
+// network; larger arrays use the loop (the unrolled code grows as N^2)
+const std::size_t kUnrolledSortMaxSize = 16;
+
+/**
+ * Projection that returns its argument unchanged
+ */
+struct Identity {
+    template <typename T>
+    constexpr T&& operator()(T&& value) const noexcept {
+        return std::forward<T>(value);
+    }
+};
+
+/**
+ * std::invoke usable in constant expressions: calls f(object, args...), or
+ * applies a pointer to member to object (a reference or a pointer)
+ */
+template <typename F, typename Object, typename... Args>
+constexpr decltype(auto) constexpr_invoke(F&& f, Object&& object, Args&&... args) {
+    using Function = std::decay_t<F>;
+    if constexpr (std::is_member_function_pointer<Function>::value) {
+        if constexpr (std::is_pointer<std::decay_t<Object>>::value) {
+            return ((*object).*f)(std::forward<Args>(args)...);
+        } else {
+            return (std::forward<Object>(object).*f)(std::forward<Args>(args)...);
+        }
+    } else if constexpr (std::is_member_object_pointer<Function>::value) {
+        if constexpr (std::is_pointer<std::decay_t<Object>>::value) {
+            return ((*object).*f);
+        } else {
+            return (std::forward<Object>(object).*f);
+        }
+    } else {
+        return std::forward<F>(f)(std::forward<Object>(object), std::forward<Args>(args)...);
+    }
+}
+
+/**
+ * std::swap usable in constant expressions (three moves)
+ */
+template <typename T>
+constexpr void constexpr_swap(T& a, T& b) noexcept(std::is_nothrow_move_constructible<T>::value &&
+                                                   std::is_nothrow_move_assignable<T>::value) {
+    T tmp = std::move(a);
+    a = std::move(b);
+    b = std::move(tmp);
+}
+
+template <typename It>
+constexpr void constexpr_iter_swap(It a, It b) {
+    constexpr_swap(*a, *b);
+}
+
+/**
+ * std::move_backward usable in constant expressions: a plain loop there,
+ * the library version (memmove for trivial types) at run time
+ */
+template <typename BidirIt1, typename BidirIt2>
+constexpr BidirIt2 constexpr_move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last) {
+#if defined(__GNUC__) || defined(__clang__)
+    if (!__builtin_is_constant_evaluated()) {
+        return std::move_backward(first, last, d_last);
+    }
+#endif
+    while (first != last) {
+        *--d_last = std::move(*--last);
+    }
+    return d_last;
+}
+
+/**
+ * Orders a pair: afterwards !less(b, a). Equal elements are not swapped,
+ * so a network of adjacent compare-exchanges is stable. Scalars are
+ * selected without a branch (cmov / min / max).
+ */
+template <typename T, typename Less>
+constexpr void compare_exchange(T& a, T& b, Less& less) {
+    if constexpr (std::is_scalar<T>::value) {
+        const bool swap = less(b, a);
+        const T low = swap ? b : a;
+        const T high = swap ? a : b;
+        a = low;
+        b = high;
+    } else if (less(b, a)) {
+        constexpr_swap(a, b);
+    }
+}
+
+/**
+ * Binary predicate comp(proj(a), proj(b)), used internally by the sorters
+ */
+template <typename Compare, typename Projection>
+struct ProjectedLess {
+    Compare comp;
+    Projection proj;
+
+    template <typename A, typename B>
+    constexpr bool operator()(A&& a, B&& b) {
+        return constexpr_invoke(comp, constexpr_invoke(proj, std::forward<A>(a)),
+                                constexpr_invoke(proj, std::forward<B>(b)));
+    }
+};
+
+/**
+ * Combines a comparator and a projection into one predicate
+ */
+template <typename Compare, typename Projection>
+constexpr ProjectedLess<Compare, Projection> make_projected_less(Compare comp, Projection proj) {
+    return ProjectedLess<Compare, Projection>{std::move(comp), std::move(proj)};
+}
+
+#endif // ALGOVAULT_SORTING_SORT_UTILS_H
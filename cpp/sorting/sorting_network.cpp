@@ -0,0 +1,230 @@
+/*
+ * Sorting Network Examples
+ *
+ * Description:
+ * small_sort() and network_sort() (see sorting_network.h) sort arrays of
+ * up to 32 elements with a fixed sequence of compare-exchanges, without
+ * data-dependent branches; ints and floats use AVX2 registers when the CPU
+ * has it. pdq_sort and radix_sort use them for their small pieces.
+ *
+ * Time Complexity: O(n log^2 n) compare-exchanges, n <= 32
+ * Space Complexity: O(1)
+ */
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "pdq_sort.h"
+#include "radix_sort.h"
+#include "sorting_network.h"
+using namespace std;
+
+// Sorted while compiling: the network is constexpr
+constexpr array<int, 10> kSortedTable = [] {
+    array<int, 10> table = {42, 7, 19, 3, 88, 61, 25, 3, 50, 14};
+    network_sort(table);
+    return table;
+}();
+static_assert(kSortedTable[0] == 3 && kSortedTable[1] == 3 && kSortedTable[9] == 88,
+              "network_sort must work at compile time");
+
+/**
+ * Prints a vector
+ * @param arr: vector to print
+ */
+template <typename T>
+void print_vector(const vector<T>& arr) {
+    cout << "[";
+    for (size_t i = 0; i < arr.size(); i++) {
+        cout << arr[i];
+        if (i < arr.size() - 1) {
+            cout << ", ";
+        }
+    }
+    cout << "]" << endl;
+}
+
+/**
+ * Checks small_sort against std::sort on random arrays of every size up
+ * to kSortingNetworkMaxSize
+ * @param rng: random source
+ * @param make_value: turns a random number into an element
+ */
+template <typename T, typename MakeValue>
+bool matches_std_sort(mt19937_64& rng, MakeValue make_value) {
+    bool correct = true;
+    for (size_t n = 0; n <= kSortingNetworkMaxSize; n++) {
+        for (int round = 0; round < 100; round++) {
+            vector<T> arr(n);
+            for (T& x : arr) {
+                x = make_value(rng());
+            }
+            vector<T> expected = arr;
+            sort(expected.begin(), expected.end());
+            small_sort(arr.begin(), arr.end());
+            correct = correct && arr == expected;
+        }
+    }
+    return correct;
+}
+
+/**
+ * Sorts every row of a matrix on its own
+ * @param data: rows stored one after another
+ * @param row: elements per row
+ * @param sort_fn: sorts one row [first, last)
+ * @return milliseconds taken
+ */
+template <typename SortFn>
+double sort_rows(vector<int>& data, size_t row, SortFn sort_fn) {
+    auto t0 = chrono::steady_clock::now();
+    for (size_t i = 0; i < data.size(); i += row) {
+        sort_fn(data.data() + i, data.data() + i + row);
+    }
+    auto t1 = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(t1 - t0).count();
+}
+
+// Example usage and test cases
+int main() {
+    cout << "=== Sorting Network Examples ===" << endl << endl;
+    cout << "AVX2 kernels: " << (network_sort_has_avx2() ? "yes" : "no") << endl << endl;
+
+    // Test Case 1: One small array
+    vector<int> arr1 = {64, -34, 25, 12, 22, 11, 90, -5, 0, 7, 7, 33};
+    cout << "Test 1 - 12 ints:" << endl;
+    cout << "Before: ";
+    print_vector(arr1);
+    small_sort(arr1.begin(), arr1.end());
+    cout << "After:  ";
+    print_vector(arr1);
+    cout << endl;
+
+    // Test Case 2: Network sizes and a table sorted at compile time
+    cout << "Test 2 - Compare-exchanges per network:";
+    for (size_t n : {size_t{4}, size_t{8}, size_t{16}, size_t{24}, size_t{32}}) {
+        cout << " " << n << ":" << sorting_network_size(n);
+    }
+    cout << endl << "Compile-time sorted table: ";
+    for (int x : kSortedTable) {
+        cout << x << " ";
+    }
+    cout << endl << endl;
+
+    // Test Case 3: 0-1 principle: a network that sorts every sequence of
+    // 0s and 1s sorts every input, so this checks all networks up to 16
+    bool zero_one_ok = true;
+    for (size_t n = 0; n <= 16; n++) {
+        for (uint32_t bits = 0; bits < (1u << n); bits++) {
+            vector<int> ints(n);
+            vector<int64_t> longs(n);
+            for (size_t i = 0; i < n; i++) {
+                ints[i] = static_cast<int>((bits >> i) & 1);
+                longs[i] = ints[i];
+            }
+            small_sort(ints.begin(), ints.end());
+            small_sort(longs.begin(), longs.end());
+            zero_one_ok = zero_one_ok && is_sorted(ints.begin(), ints.end()) && is_sorted(longs.begin(), longs.end());
+        }
+    }
+    cout << "Test 3 - Every 0-1 input up to 16 elements sorted: " << (zero_one_ok ? "yes" : "no") << endl;
+
+    // Test Case 4: Random arrays of every size vs std::sort: int and float
+    // (AVX2 kernels), int64_t and double (comparator table)
+    mt19937_64 rng(17);
+    bool random_ok = matches_std_sort<int>(rng, [](uint64_t r) { return static_cast<int>(r % 21) - 10; }) &&
+                     matches_std_sort<int>(rng, [](uint64_t r) { return static_cast<int>(r); }) &&
+                     matches_std_sort<float>(rng, [](uint64_t r) { return static_cast<float>(r % 1000) / 8; }) &&
+                     matches_std_sort<int64_t>(rng, [](uint64_t r) { return static_cast<int64_t>(r); }) &&
+                     matches_std_sort<double>(rng, [](uint64_t r) { return static_cast<double>(r % 100); });
+    cout << "Test 4 - Random arrays up to 32 elements sorted correctly: " << (random_ok ? "yes" : "no") << endl;
+
+    // Test Case 5: -0.0 and 0.0 compare equal; the network must keep both
+    // (and every other value) instead of duplicating one of them
+    bool zeros_ok = true;
+    for (size_t n = 1; n <= kSortingNetworkMaxSize; n++) {
+        for (int round = 0; round < 100; round++) {
+            vector<float> arr(n);
+            for (float& x : arr) {
+                const uint64_t r = rng();
+                x = r % 4 == 0 ? -0.0f : r % 4 == 1 ? 0.0f : static_cast<float>(static_cast<int>(r % 7) - 3);
+            }
+            const size_t negative_zeros = count_if(arr.begin(), arr.end(), [](float x) { return x == 0 && signbit(x); });
+            vector<float> expected = arr;
+            sort(expected.begin(), expected.end());
+            small_sort(arr.begin(), arr.end());
+            zeros_ok = zeros_ok && arr == expected && is_sorted(arr.begin(), arr.end()) &&
+                       count_if(arr.begin(), arr.end(), [](float x) { return x == 0 && signbit(x); }) ==
+                           static_cast<ptrdiff_t>(negative_zeros);
+        }
+    }
+    cout << "Test 5 - Signed zeros kept when sorting floats: " << (zeros_ok ? "yes" : "no") << endl;
+
+    // Test Case 6: Comparator, projection, non-contiguous storage, records
+    vector<int> descending = {5, 1, 4, 2, 3, 9, 0};
+    small_sort(descending.begin(), descending.end(), greater<>());
+    deque<int> queue = {8, 3, 9, 1, 7, 2, 6, 5, 4, 0};
+    small_sort(queue.begin(), queue.end());
+    vector<pair<int, string>> records = {{3, "c"}, {1, "a"}, {2, "b"}, {0, "z"}};
+    small_sort(records.begin(), records.end(), less<>(), &pair<int, string>::first);
+    array<double, 6> fixed = {2.5, -1.0, 0.0, 9.75, -3.5, 1.0};
+    network_sort(fixed);
+    bool variants_ok = is_sorted(descending.begin(), descending.end(), greater<>()) &&
+                       is_sorted(queue.begin(), queue.end()) && records.front().second == "z" &&
+                       records.back().second == "c" && is_sorted(fixed.begin(), fixed.end());
+    cout << "Test 6 - Comparator, deque, records and std::array sorted correctly: "
+         << (variants_ok ? "yes" : "no") << endl << endl;
+
+    // Test Case 7: Many tiny arrays, the case networks are made for
+    const size_t kRows = 200000;
+    cout << "Test 7 - " << kRows << " random rows, each sorted on its own:" << endl;
+    for (size_t row : {size_t{8}, size_t{16}, size_t{32}}) {
+        vector<int> data(kRows * row);
+        for (int& x : data) {
+            x = static_cast<int>(rng());
+        }
+        vector<int> by_insertion = data;
+        vector<int> by_network = data;
+        double insertion_ms = sort_rows(by_insertion, row, [](int* first, int* last) { insertion_sort(first, last); });
+        double network_ms = sort_rows(by_network, row, [](int* first, int* last) { small_sort(first, last); });
+        cout << "  rows of " << row << ": insertion_sort " << insertion_ms << " ms, small_sort " << network_ms
+             << " ms" << (by_insertion == by_network ? "" : " (WRONG RESULT)") << endl;
+    }
+    cout << endl;
+
+    // Test Case 8: The general sorters finish their small pieces with networks
+    bool general_ok = true;
+    for (size_t n : {size_t{33}, size_t{1000}, size_t{100000}}) {
+        vector<int> ints(n);
+        vector<double> doubles(n);
+        vector<uint32_t> keys(n);
+        for (size_t i = 0; i < n; i++) {
+            ints[i] = static_cast<int>(rng() % 50);
+            doubles[i] = static_cast<double>(static_cast<int64_t>(rng() % 100000)) - 50000.0;
+            keys[i] = static_cast<uint32_t>(rng());
+        }
+        pdq_sort(ints.begin(), ints.end());
+        pdq_sort(doubles.begin(), doubles.end());
+        radix_sort(keys.begin(), keys.end());
+        general_ok = general_ok && is_sorted(ints.begin(), ints.end()) &&
+                     is_sorted(doubles.begin(), doubles.end()) && is_sorted(keys.begin(), keys.end());
+    }
+    vector<uint16_t> few(20);
+    for (uint16_t& x : few) {
+        x = static_cast<uint16_t>(rng());
+    }
+    radix_sort(few.begin(), few.end());
+    general_ok = general_ok && is_sorted(few.begin(), few.end());
+    cout << "Test 8 - pdq_sort and radix_sort results correct: " << (general_ok ? "yes" : "no") << endl;
+
+    return 0;
+}
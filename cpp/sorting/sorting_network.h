@@ -0,0 +1,556 @@
+/*
+ * Sorting Networks for small arrays
+ *
+ * Description:
+ * A sorting network is a fixed list of compare-exchanges (i, j): after
+ * each one, element i is not larger than element j. The list depends only
+ * on the number of elements, never on the data, so a network sorts
+ * without data-dependent branches: no mispredictions, unlike insertion
+ * sort on random data.
+ *
+ *   - The networks are Batcher's odd-even merge sort, generated at compile
+ *     time for every size up to kSortingNetworkMaxSize (32). A size that
+ *     is not a power of two uses the next power of two network without the
+ *     comparators that touch the missing elements (63 compare-exchanges
+ *     for 16 elements, 191 for 32).
+ *   - network_sort<N>(first) and network_sort(std::array) unroll all
+ *     compare-exchanges of the size N network; they are constexpr.
+ *   - small_sort(first, last) takes the size at runtime and walks the
+ *     comparator table of that size. ints and floats sorted with the
+ *     default comparator use AVX2 instead when the CPU has it: up to 32
+ *     elements are held in four registers and sorted by a bitonic network,
+ *     8 compare-exchanges per step (min/max for ints, one compare and
+ *     two blends for floats, so -0.0 and 0.0 both survive). Below
+ *     kSortingNetworkSimdMinSize elements the table is faster.
+ *   - pdq_sort and radix_sort finish their small pieces with small_sort
+ *     when the elements are arithmetic (see use_sorting_network).
+ *
+ * Scalars are compare-exchanged with conditional moves (compare_exchange
+ * in sort_utils.h); other types still sort correctly but branch. Networks
+ * are not stable. Floats must not contain NaN (as for std::sort).
+ *
+ * Time Complexity: O(n log^2 n) compare-exchanges, n <= 32
+ * Space Complexity: O(1)
+ */
+
+#ifndef ALGOVAULT_SORTING_SORTING_NETWORK_H
+#define ALGOVAULT_SORTING_SORTING_NETWORK_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "insertion_sort.h"
+#include "sort_utils.h"
+#include "../searching/simd_linear_search.h"
+
+// Largest array sorted by a network; small_sort uses insertion sort above
+const std::size_t kSortingNetworkMaxSize = 32;
+
+// Below this size the comparator table beats the AVX2 setup cost
+const std::size_t kSortingNetworkSimdMinSize = 6;
+
+/**
+ * One compare-exchange: afterwards element low is not larger than high
+ */
+struct NetworkComparator {
+    std::uint8_t low = 0;
+    std::uint8_t high = 0;
+};
+
+/**
+ * Calls visit(i, j) for every comparator of the n-input network, in order
+ * (Batcher's odd-even merge sort, pruned to n inputs)
+ */
+template <typename Visit>
+constexpr void for_each_network_comparator(std::size_t n, Visit&& visit) {
+    for (std::size_t p = 1; p < n; p *= 2) {
+        for (std::size_t k = p; k >= 1; k /= 2) {
+            for (std::size_t j = k % p; j + k < n; j += 2 * k) {
+                for (std::size_t i = 0; i < k && i + j + k < n; i++) {
+                    // Only merge within blocks of 2p elements
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                        visit(i + j, i + j + k);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * Number of comparators of the n-input network
+ */
+constexpr std::size_t sorting_network_size(std::size_t n) {
+    std::size_t size = 0;
+    for_each_network_comparator(n, [&size](std::size_t, std::size_t) { size++; });
+    return size;
+}
+
+/**
+ * The comparators of the N-input network
+ */
+template <std::size_t N>
+struct SortingNetwork {
+    std::array<NetworkComparator, sorting_network_size(N)> comparators{};
+};
+
+template <std::size_t N>
+constexpr SortingNetwork<N> make_sorting_network() {
+    static_assert(N <= kSortingNetworkMaxSize, "make_sorting_network: too many inputs");
+    SortingNetwork<N> network;
+    std::size_t next = 0;
+    for_each_network_comparator(N, [&network, &next](std::size_t i, std::size_t j) {
+        network.comparators[next].low = static_cast<std::uint8_t>(i);
+        network.comparators[next].high = static_cast<std::uint8_t>(j);
+        next++;
+    });
+    return network;
+}
+
+template <std::size_t N>
+constexpr SortingNetwork<N> kSortingNetwork = make_sorting_network<N>();
+
+/**
+ * Comparators of every size from 0 to kSortingNetworkMaxSize in one
+ * array; size n uses comparators[begin[n] .. begin[n + 1])
+ */
+struct SortingNetworkTable {
+    static constexpr std::size_t kTotal = [] {
+        std::size_t total = 0;
+        for (std::size_t n = 0; n <= kSortingNetworkMaxSize; n++) {
+            total += sorting_network_size(n);
+        }
+        return total;
+    }();
+
+    std::array<std::uint16_t, kSortingNetworkMaxSize + 2> begin{};
+    std::array<NetworkComparator, kTotal> comparators{};
+};
+
+constexpr SortingNetworkTable make_sorting_network_table() {
+    SortingNetworkTable table;
+    std::size_t next = 0;
+    for (std::size_t n = 0; n <= kSortingNetworkMaxSize; n++) {
+        table.begin[n] = static_cast<std::uint16_t>(next);
+        for_each_network_comparator(n, [&table, &next](std::size_t i, std::size_t j) {
+            table.comparators[next].low = static_cast<std::uint8_t>(i);
+            table.comparators[next].high = static_cast<std::uint8_t>(j);
+            next++;
+        });
+    }
+    table.begin[kSortingNetworkMaxSize + 1] = static_cast<std::uint16_t>(next);
+    return table;
+}
+
+/**
+ * The table, built once by the compiler
+ */
+inline const SortingNetworkTable& sorting_network_table() {
+    static constexpr SortingNetworkTable table = make_sorting_network_table();
+    return table;
+}
+
+/**
+ * Comparator C of the size N network, with constant indices
+ */
+template <std::size_t N, std::size_t C, typename RandomIt, typename Less>
+constexpr void network_compare_exchange(RandomIt first, Less& less) {
+    constexpr NetworkComparator comparator = kSortingNetwork<N>.comparators[C];
+    compare_exchange(first[comparator.low], first[comparator.high], less);
+}
+
+template <std::size_t N, typename RandomIt, typename Less, std::size_t... C>
+constexpr void unrolled_network_sort(RandomIt first, Less& less, std::index_sequence<C...>) {
+    (network_compare_exchange<N, C>(first, less), ...);
+}
+
+/**
+ * Sorts the N elements starting at first with the unrolled size N network
+ * @param first: start of the N elements (random access)
+ * @param comp: strict weak ordering on projected values
+ * @param proj: projection applied before comparing
+ */
+template <std::size_t N, typename RandomIt, typename Compare = std::less<>, typename Projection = Identity>
+constexpr void network_sort(RandomIt first, Compare comp = {}, Projection proj = {}) {
+    static_assert(N <= kSortingNetworkMaxSize, "network_sort: at most kSortingNetworkMaxSize elements");
+    auto less = make_projected_less(std::move(comp), std::move(proj));
+    unrolled_network_sort<N>(first, less, std::make_index_sequence<sorting_network_size(N)>());
+}
+
+/**
+ * Sorts a std::array of up to kSortingNetworkMaxSize elements with the
+ * unrolled network
+ */
+template <typename T, std::size_t N, typename Compare = std::less<>, typename Projection = Identity>
+constexpr void network_sort(std::array<T, N>& values, Compare comp = {}, Projection proj = {}) {
+    network_sort<N>(values.begin(), std::move(comp), std::move(proj));
+}
+
+#ifdef ALGOVAULT_X86_SIMD
+
+/**
+ * AVX2 building blocks for 8 ints per register
+ */
+struct NetworkLanesInt {
+    using Value = int;
+    using Vector = __m256i;
+
+    /**
+     * Register with every lane set to the largest int
+     */
+    __attribute__((target("avx2")))
+    static Vector sentinel() { return _mm256_set1_epi32(std::numeric_limits<int>::max()); }
+
+    /**
+     * Compare-exchange across two registers: afterwards low holds the
+     * smaller and high the larger value of every lane
+     */
+    __attribute__((target("avx2")))
+    static void minmax(Vector& low, Vector& high) {
+        const Vector smaller = _mm256_min_epi32(low, high);
+        high = _mm256_max_epi32(low, high);
+        low = smaller;
+    }
+
+    /**
+     * Compare-exchange of v with its partner lanes w: the lanes in
+     * HighLanes keep the larger value, the other lanes the smaller one
+     */
+    template <int HighLanes>
+    __attribute__((target("avx2")))
+    static Vector exchange(Vector v, Vector w) {
+        return _mm256_blend_epi32(_mm256_min_epi32(v, w), _mm256_max_epi32(v, w), HighLanes);
+    }
+
+    /**
+     * Lane i of the result is lane i ^ Pattern of v
+     */
+    template <int Pattern>
+    __attribute__((target("avx2")))
+    static Vector partner(Vector v) {
+        if constexpr (Pattern == 1) {
+            return _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+        } else if constexpr (Pattern == 2) {
+            return _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+        } else if constexpr (Pattern == 3) {
+            return _mm256_shuffle_epi32(v, _MM_SHUFFLE(0, 1, 2, 3));
+        } else if constexpr (Pattern == 4) {
+            return _mm256_permute4x64_epi64(v, _MM_SHUFFLE(1, 0, 3, 2));
+        } else {
+            static_assert(Pattern == 7, "partner: unsupported lane pattern");
+            return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+        }
+    }
+
+    /**
+     * Loads data[0 .. count) (count <= 8); the other lanes get the largest
+     * int, which sorts behind every element
+     */
+    __attribute__((target("avx2")))
+    static Vector load(const int* data, int count) {
+        if (count == 8) {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        }
+        // Masked loads and stores are slow on many CPUs, a partial
+        // register goes through a padded copy on the stack instead
+        int padded[8];
+        for (int i = 0; i < 8; i++) {
+            padded[i] = i < count ? data[i] : std::numeric_limits<int>::max();
+        }
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(padded));
+    }
+
+    __attribute__((target("avx2")))
+    static void store(int* data, int count, Vector v) {
+        if (count == 8) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(data), v);
+            return;
+        }
+        int padded[8];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(padded), v);
+        for (int i = 0; i < count; i++) {
+            data[i] = padded[i];
+        }
+    }
+};
+
+/**
+ * AVX2 building blocks for 8 floats per register
+ *
+ * min_ps and max_ps both return their second operand when the values
+ * compare equal, so -0.0 and 0.0 would come out as two copies of one of
+ * them. Instead, one compare decides whether a pair is swapped and both
+ * outputs are blended from it: equal values keep their places.
+ */
+struct NetworkLanesFloat {
+    using Value = float;
+    using Vector = __m256;
+
+    __attribute__((target("avx2")))
+    static Vector sentinel() { return _mm256_set1_ps(std::numeric_limits<float>::infinity()); }
+
+    __attribute__((target("avx2")))
+    static void minmax(Vector& low, Vector& high) {
+        const Vector swap = _mm256_cmp_ps(high, low, _CMP_LT_OQ);
+        const Vector smaller = _mm256_blendv_ps(low, high, swap);
+        high = _mm256_blendv_ps(high, low, swap);
+        low = smaller;
+    }
+
+    // A lane takes its partner's value when the partner is smaller (low
+    // lanes) or larger (high lanes), so both lanes of a pair test the same
+    // comparison and either both swap or neither does
+    template <int HighLanes>
+    __attribute__((target("avx2")))
+    static Vector exchange(Vector v, Vector w) {
+        const Vector take_partner =
+            _mm256_blend_ps(_mm256_cmp_ps(w, v, _CMP_LT_OQ), _mm256_cmp_ps(w, v, _CMP_GT_OQ), HighLanes);
+        return _mm256_blendv_ps(v, w, take_partner);
+    }
+
+    template <int Pattern>
+    __attribute__((target("avx2")))
+    static Vector partner(Vector v) {
+        if constexpr (Pattern == 1) {
+            return _mm256_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+        } else if constexpr (Pattern == 2) {
+            return _mm256_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2));
+        } else if constexpr (Pattern == 3) {
+            return _mm256_shuffle_ps(v, v, _MM_SHUFFLE(0, 1, 2, 3));
+        } else if constexpr (Pattern == 4) {
+            return _mm256_permute2f128_ps(v, v, 1);
+        } else {
+            static_assert(Pattern == 7, "partner: unsupported lane pattern");
+            return _mm256_permutevar8x32_ps(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+        }
+    }
+
+    __attribute__((target("avx2")))
+    static Vector load(const float* data, int count) {
+        if (count == 8) {
+            return _mm256_loadu_ps(data);
+        }
+        float padded[8];
+        for (int i = 0; i < 8; i++) {
+            padded[i] = i < count ? data[i] : std::numeric_limits<float>::infinity();
+        }
+        return _mm256_loadu_ps(padded);
+    }
+
+    __attribute__((target("avx2")))
+    static void store(float* data, int count, Vector v) {
+        if (count == 8) {
+            _mm256_storeu_ps(data, v);
+            return;
+        }
+        float padded[8];
+        _mm256_storeu_ps(padded, v);
+        for (int i = 0; i < count; i++) {
+            data[i] = padded[i];
+        }
+    }
+};
+
+/**
+ * One layer inside a register: compare-exchange lane i with lane
+ * i ^ Pattern; the lane with the higher index keeps the larger value
+ */
+template <typename Lanes, int Pattern>
+__attribute__((target("avx2")))
+inline typename Lanes::Vector network_layer(typename Lanes::Vector v) {
+    constexpr int kHighLanes = Pattern == 1 ? 0xAA : Pattern <= 3 ? 0xCC : 0xF0;
+    return Lanes::template exchange<kHighLanes>(v, Lanes::template partner<Pattern>(v));
+}
+
+/**
+ * Sorts the 8 lanes of v (bitonic sort, 6 layers)
+ */
+template <typename Lanes>
+__attribute__((target("avx2")))
+inline typename Lanes::Vector network_sort8(typename Lanes::Vector v) {
+    v = network_layer<Lanes, 1>(v);
+    v = network_layer<Lanes, 3>(v);
+    v = network_layer<Lanes, 1>(v);
+    v = network_layer<Lanes, 7>(v);
+    v = network_layer<Lanes, 2>(v);
+    return network_layer<Lanes, 1>(v);
+}
+
+/**
+ * Sorts the 8 lanes of a bitonic (rising then falling, or the reverse) v
+ */
+template <typename Lanes>
+__attribute__((target("avx2")))
+inline typename Lanes::Vector network_merge8(typename Lanes::Vector v) {
+    v = network_layer<Lanes, 4>(v);
+    v = network_layer<Lanes, 2>(v);
+    return network_layer<Lanes, 1>(v);
+}
+
+/**
+ * Merges two sorted registers into the sorted 16 lanes (a, b). Comparing
+ * a with reversed b leaves two bitonic registers; b ends up reversed,
+ * which a bitonic merge does not mind.
+ */
+template <typename Lanes>
+__attribute__((target("avx2")))
+inline void network_merge16_sorted(typename Lanes::Vector& a, typename Lanes::Vector& b) {
+    b = Lanes::template partner<7>(b);
+    Lanes::minmax(a, b);
+    a = network_merge8<Lanes>(a);
+    b = network_merge8<Lanes>(b);
+}
+
+/**
+ * Sorts the bitonic 16 lanes (a, b)
+ */
+template <typename Lanes>
+__attribute__((target("avx2")))
+inline void network_merge16_bitonic(typename Lanes::Vector& a, typename Lanes::Vector& b) {
+    Lanes::minmax(a, b);
+    a = network_merge8<Lanes>(a);
+    b = network_merge8<Lanes>(b);
+}
+
+/**
+ * Sorts data[0 .. n) in registers, n <= kSortingNetworkMaxSize (n padded
+ * to 8, 16 or 32 lanes)
+ */
+template <typename Lanes>
+__attribute__((target("avx2")))
+inline void network_sort_avx2(typename Lanes::Value* data, std::size_t n) {
+    using Vector = typename Lanes::Vector;
+    const int count = static_cast<int>(n);
+    if (count <= 8) {
+        Lanes::store(data, count, network_sort8<Lanes>(Lanes::load(data, count)));
+        return;
+    }
+
+    Vector a = network_sort8<Lanes>(Lanes::load(data, 8));
+    Vector b = network_sort8<Lanes>(Lanes::load(data + 8, count - 8));
+    network_merge16_sorted<Lanes>(a, b);
+    if (count <= 16) {
+        Lanes::store(data, 8, a);
+        Lanes::store(data + 8, count - 8, b);
+        return;
+    }
+
+    // Up to 24 elements the fourth register is all padding
+    Vector c = network_sort8<Lanes>(Lanes::load(data + 16, std::min(count - 16, 8)));
+    Vector d = count > 24 ? network_sort8<Lanes>(Lanes::load(data + 24, count - 24)) : Lanes::sentinel();
+    network_merge16_sorted<Lanes>(c, d);
+
+    // Compare lane i with lane 31 - i; the upper half (d', c') comes out
+    // reversed, so it is merged in that order
+    Vector high_d = Lanes::template partner<7>(d);
+    Vector high_c = Lanes::template partner<7>(c);
+    Lanes::minmax(a, high_d);
+    Lanes::minmax(b, high_c);
+    network_merge16_bitonic<Lanes>(a, b);
+    network_merge16_bitonic<Lanes>(high_d, high_c);
+    Lanes::store(data, 8, a);
+    Lanes::store(data + 8, 8, b);
+    Lanes::store(data + 16, std::min(count - 16, 8), high_d);
+    if (count > 24) {
+        Lanes::store(data + 24, count - 24, high_c);
+    }
+}
+
+#endif // ALGOVAULT_X86_SIMD
+
+/**
+ * @return true if this CPU runs the AVX2 kernels (checked once)
+ */
+inline bool network_sort_has_avx2() {
+#ifdef ALGOVAULT_X86_SIMD
+    static const bool has_avx2 = detect_simd_level() >= SimdLevel::kAVX2;
+    return has_avx2;
+#else
+    return false;
+#endif
+}
+
+/**
+ * True for elements that a network sorts without branches; the general
+ * sorters finish small pieces of these with small_sort_with
+ */
+template <typename T>
+struct use_sorting_network : std::is_arithmetic<T> {};
+
+/**
+ * True if Less compares plain values with operator<
+ */
+template <typename Less>
+struct is_default_less : std::false_type {};
+
+template <>
+struct is_default_less<ProjectedLess<std::less<>, Identity>> : std::true_type {};
+
+/**
+ * True for iterators over contiguous T (pointers, vector iterators)
+ */
+template <typename RandomIt, typename T>
+struct is_contiguous_iterator
+    : std::integral_constant<bool, std::is_same<RandomIt, T*>::value ||
+                                       std::is_same<RandomIt, typename std::vector<T>::iterator>::value> {};
+
+/**
+ * Sorts [first, last) with the size (last - first) network, walking the
+ * comparator table; ints and floats in contiguous memory with the default
+ * comparator use the AVX2 kernel instead
+ * Precondition: last - first <= kSortingNetworkMaxSize
+ */
+template <typename RandomIt, typename Less>
+void small_sort_with(RandomIt first, RandomIt last, Less& less) {
+    using Value = typename std::iterator_traits<RandomIt>::value_type;
+    const std::size_t n = static_cast<std::size_t>(last - first);
+
+#ifdef ALGOVAULT_X86_SIMD
+    if constexpr (is_default_less<Less>::value && is_contiguous_iterator<RandomIt, Value>::value) {
+        if constexpr (std::is_same<Value, int>::value) {
+            if (n >= kSortingNetworkSimdMinSize && network_sort_has_avx2()) {
+                network_sort_avx2<NetworkLanesInt>(&*first, n);
+                return;
+            }
+        } else if constexpr (std::is_same<Value, float>::value) {
+            if (n >= kSortingNetworkSimdMinSize && network_sort_has_avx2()) {
+                network_sort_avx2<NetworkLanesFloat>(&*first, n);
+                return;
+            }
+        }
+    }
+#endif
+
+    const SortingNetworkTable& table = sorting_network_table();
+    const NetworkComparator* comparator = table.comparators.data() + table.begin[n];
+    const NetworkComparator* end = table.comparators.data() + table.begin[n + 1];
+    for (; comparator != end; ++comparator) {
+        compare_exchange(first[comparator->low], first[comparator->high], less);
+    }
+}
+
+/**
+ * Sorts [first, last) with a sorting network if it has at most
+ * kSortingNetworkMaxSize elements, otherwise with insertion sort
+ * @param first, last: random access range to sort
+ * @param comp: strict weak ordering on projected values
+ * @param proj: projection applied before comparing
+ */
+template <typename RandomIt, typename Compare = std::less<>, typename Projection = Identity>
+void small_sort(RandomIt first, RandomIt last, Compare comp = {}, Projection proj = {}) {
+    auto less = make_projected_less(std::move(comp), std::move(proj));
+    if (last - first > static_cast<std::ptrdiff_t>(kSortingNetworkMaxSize)) {
+        insertion_sort_with(first, last, less);
+    } else {
+        small_sort_with(first, last, less);
+    }
+}
+
+#endif // ALGOVAULT_SORTING_SORTING_NETWORK_H
@@ -15,69 +15,28 @@
  *
  * Note:
  * Topological sort is only possible for Directed Acyclic Graphs (DAGs).
- * If a cycle exists, topological sorting is not possible.
+ * If a cycle exists, topological sorting is not possible: the functions
+ * return an empty order and can report the offending cycle to the caller.
+ *
+ * The functions are in topological_sort.h; this file runs them on examples.
  */
 
+#include <array>
+#include <filesystem>
 #include <iostream>
+#include <string>
+#include <utility>
 #include <vector>
-#include <queue>
+#include "../graph/graph_file.h"
+#include "topological_sort.h"
 using namespace std;
 
-/**
- * Performs topological sort on a directed graph
- * @param V: number of vertices
- * @param adj: adjacency list representing the graph
- * @return vector containing topological order of vertices
- */
-vector<int> topological_sort(int V, const vector<vector<int>>& adj) {
-    vector<int> indegree(V, 0);
-
-    // Calculate indegree of each vertex
-    for (int u = 0; u < V; u++) {
-        for (int v : adj[u]) {
-            indegree[v]++;
-        }
-    }
-
-    // Push all vertices with indegree 0 into queue
-    queue<int> q;
-    for (int i = 0; i < V; i++) {
-        if (indegree[i] == 0) {
-            q.push(i);
-        }
-    }
-
-    vector<int> topo_order;
-
-    // Process vertices in BFS order
-    while (!q.empty()) {
-        int node = q.front();
-        q.pop();
-        topo_order.push_back(node);
-
-        // Reduce indegree of adjacent vertices
-        for (int neighbor : adj[node]) {
-            indegree[neighbor]--;
-            if (indegree[neighbor] == 0) {
-                q.push(neighbor);
-            }
-        }
-    }
-
-    // Cycle detection
-    if (topo_order.size() != V) {
-        cout << "Error: Graph contains a cycle." << endl;
-        return {};
-    }
-
-    return topo_order;
-}
-
 /**
  * Prints a vector
  * @param arr: vector to print
  */
-void print_vector(const vector<int>& arr) {
+template <typename T>
+void print_vector(const vector<T>& arr) {
     cout << "[";
     for (size_t i = 0; i < arr.size(); i++) {
         cout << arr[i];
@@ -88,6 +47,37 @@ void print_vector(const vector<int>& arr) {
     cout << "]" << endl;
 }
 
+// Components of a service and what each must be initialized after
+enum Component { kConfig, kLogger, kDatabase, kCache, kServer, kComponents };
+const char* const kComponentNames[kComponents] = {"config", "logger", "database", "cache", "server"};
+constexpr array<pair<int, int>, 6> kInitDependencies = {{
+    {kConfig, kLogger},
+    {kConfig, kDatabase},
+    {kLogger, kDatabase},
+    {kDatabase, kCache},
+    {kCache, kServer},
+    {kLogger, kServer},
+}};
+
+// Initialization order, computed by the compiler
+constexpr StaticTopologicalOrder<kComponents> kInitOrder = topological_sort<kComponents>(kInitDependencies);
+static_assert(kInitOrder.is_dag(), "initialization dependencies contain a cycle");
+static_assert(kInitOrder.order[0] == kConfig && kInitOrder.order[kComponents - 1] == kServer,
+              "config first, server last");
+
+/**
+ * Prints a cycle as a -> b -> ... -> a
+ * @param cycle: vertices of the cycle
+ */
+template <typename T>
+void print_cycle(const vector<T>& cycle) {
+    cout << "Error: Graph contains a cycle: ";
+    for (const T& v : cycle) {
+        cout << v << " -> ";
+    }
+    cout << cycle.front() << endl;
+}
+
 // Example usage and test cases
 int main() {
     cout << "=== Topological Sort Examples ===" << endl << endl;
@@ -155,10 +145,92 @@ int main() {
     adj5[2].push_back(0);
 
     cout << "Test 5 - Graph with a cycle:" << endl;
-    vector<int> result5 = topological_sort(V5, adj5);
+    vector<int> cycle5;
+    vector<int> result5 = topological_sort(V5, adj5, &cycle5);
+    print_cycle(cycle5);
     cout << "Topological Order: ";
     print_vector(result5);
     cout << endl;
 
+    // Test Case 6: Simple DAG from Test 1 in CSR form
+    CSRGraph<int32_t> csr6 = CSRGraph<int32_t>::from_adjacency_list(adj1);
+
+    cout << "Test 6 - Simple DAG (CSR graph):" << endl;
+    vector<int32_t> result6 = topological_sort(csr6);
+    cout << "Topological Order: ";
+    print_vector(result6);
+    cout << endl;
+
+    // Test Case 7: CSR graph with 64-bit ids built from an edge list
+    vector<pair<int64_t, int64_t>> edges7 = {{3, 1}, {1, 0}, {3, 2}, {2, 0}};
+    CSRGraph<int64_t> csr7 = CSRGraph<int64_t>::from_edge_list(4, edges7);
+
+    cout << "Test 7 - Diamond DAG (CSR graph, 64-bit ids):" << endl;
+    vector<int64_t> result7 = topological_sort(csr7);
+    cout << "Topological Order: ";
+    print_vector(result7);
+    cout << endl;
+
+    // Test Case 8: Cycle in CSR form
+    CSRGraph<int32_t> csr8 = CSRGraph<int32_t>::from_adjacency_list(adj5);
+
+    cout << "Test 8 - Graph with a cycle (CSR graph):" << endl;
+    vector<int32_t> cycle8;
+    vector<int32_t> result8 = topological_sort(csr8, &cycle8);
+    print_cycle(cycle8);
+    cout << "Topological Order: ";
+    print_vector(result8);
+    cout << endl;
+
+    // Test Case 9: Cycle hidden behind an acyclic prefix
+    int V9 = 6;
+    vector<vector<int>> adj9(V9);
+
+    adj9[0].push_back(1);
+    adj9[1].push_back(2);
+    adj9[2].push_back(3);
+    adj9[3].push_back(4);
+    adj9[4].push_back(2);
+    adj9[4].push_back(5);
+
+    cout << "Test 9 - Cycle reachable from a DAG part:" << endl;
+    vector<int> cycle9;
+    vector<int> result9 = topological_sort(V9, adj9, &cycle9);
+    print_cycle(cycle9);
+    cout << "Topological Order: ";
+    print_vector(result9);
+    cout << endl;
+
+    // Test Case 10: Diamond DAG from Test 7, memory-mapped from a graph file
+    string graph_path = (filesystem::temp_directory_path() / "algovault_topo_graph.bin").string();
+    write_graph_file(graph_path, csr7);
+    MappedGraph<int64_t> mapped10(graph_path);
+
+    cout << "Test 10 - Diamond DAG (memory-mapped graph file):" << endl;
+    vector<int64_t> result10 = topological_sort(mapped10.graph());
+    cout << "Topological Order: ";
+    print_vector(result10);
+    cout << endl;
+    filesystem::remove(graph_path);
+
+    // Test Case 11: Static initialization order, computed at compile time
+    cout << "Test 11 - Initialization order (compile time):" << endl;
+    cout << "Order:";
+    for (int component : kInitOrder.order) {
+        cout << " " << kComponentNames[component];
+    }
+    cout << endl << endl;
+
+    // Test Case 12: Compile-time version on the graph of Test 1, and a cycle
+    constexpr array<pair<int, int>, 6> edges12 = {{{5, 2}, {5, 0}, {4, 0}, {4, 1}, {2, 3}, {3, 1}}};
+    constexpr auto result12 = topological_sort<6>(edges12);
+    constexpr array<pair<int, int>, 3> cycle12 = {{{0, 1}, {1, 2}, {2, 0}}};
+    static_assert(!topological_sort<3>(cycle12).is_dag(), "cycle detected at compile time");
+    vector<int> static_order(result12.order.begin(), result12.order.end());
+    cout << "Test 12 - Simple DAG from Test 1 (compile time):" << endl;
+    cout << "Topological Order: ";
+    print_vector(static_order);
+    cout << "Orders match: " << (static_order == topological_sort(V1, adj1) ? "yes" : "no") << endl;
+
     return 0;
 }
\ No newline at end of file
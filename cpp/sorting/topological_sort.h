@@ -0,0 +1,219 @@
+/*
+ * Topological Sort (Kahn's Algorithm)
+ *
+ * Description:
+ * The topological sort functions shown in topological_sort.cpp, usable
+ * from other programs (the benchmark suite, applications):
+ *   - topological_sort(V, adj, cycle): adjacency list version
+ *   - topological_sort(graph, cycle): CSRGraph or CSRGraphView version
+ *   - topological_sort<V>(edges): small graph in a std::array of edges,
+ *     constexpr, so static dependency tables (e.g. the initialization
+ *     order of components) can be ordered and checked by the compiler
+ * The first two return an empty order for graphs with a cycle and can
+ * report it.
+ *
+ * Time Complexity: O(V + E)
+ * Space Complexity: O(V)
+ */
+
+#ifndef ALGOVAULT_SORTING_TOPOLOGICAL_SORT_H
+#define ALGOVAULT_SORTING_TOPOLOGICAL_SORT_H
+
+#include <array>
+#include <cstddef>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "../graph/csr_graph.h"
+#include "../graph/find_cycle.h"
+#include "../profiling/perf_counters.h"
+
+/**
+ * Performs topological sort on a directed graph
+ * @param V: number of vertices
+ * @param adj: adjacency list representing the graph
+ * @param cycle: optional, receives the vertices of one cycle if the graph
+ *               is not a DAG (edges cycle[0] -> cycle[1] -> ... -> cycle[0])
+ * @return vector containing topological order of vertices,
+ *         empty if the graph contains a cycle
+ */
+inline std::vector<int> topological_sort(int V, const std::vector<std::vector<int>>& adj,
+                                         std::vector<int>* cycle = nullptr) {
+    ALGOVAULT_PERF_SCOPE("topological_sort/indegree");
+    std::vector<int> indegree(V, 0);
+
+    // Calculate indegree of each vertex
+    for (int u = 0; u < V; u++) {
+        for (int v : adj[u]) {
+            indegree[v]++;
+        }
+    }
+
+    // Push all vertices with indegree 0 into queue
+    std::queue<int> q;
+    for (int i = 0; i < V; i++) {
+        if (indegree[i] == 0) {
+            q.push(i);
+        }
+    }
+
+    std::vector<int> topo_order;
+
+    // Process vertices in BFS order
+    ALGOVAULT_PERF_NEXT("topological_sort/queue_drain");
+    while (!q.empty()) {
+        int node = q.front();
+        q.pop();
+        topo_order.push_back(node);
+
+        // Reduce indegree of adjacent vertices
+        for (int neighbor : adj[node]) {
+            indegree[neighbor]--;
+            if (indegree[neighbor] == 0) {
+                q.push(neighbor);
+            }
+        }
+    }
+
+    // Cycle detection
+    if (topo_order.size() != static_cast<std::size_t>(V)) {
+        if (cycle != nullptr) {
+            *cycle = find_cycle(V, [&](int u) -> const std::vector<int>& { return adj[u]; });
+        }
+        return {};
+    }
+
+    return topo_order;
+}
+
+/**
+ * Performs topological sort on a directed graph in CSR form
+ *
+ * In-degrees are counted with one sequential pass over the neighbor
+ * array, and the output vector doubles as the queue of zero in-degree
+ * vertices (consumed through a head index), so the only allocations are
+ * the in-degree array and the result.
+ *
+ * @param graph: directed CSRGraph, or CSRGraphView (e.g. a memory-mapped
+ *               graph file)
+ * @param cycle: optional, receives the vertices of one cycle if the graph
+ *               is not a DAG
+ * @return vector containing topological order of vertices,
+ *         empty if the graph contains a cycle
+ */
+template <typename Graph>
+std::vector<GraphVertexId<Graph>> topological_sort(const Graph& graph,
+                                                   std::vector<GraphVertexId<Graph>>* cycle = nullptr) {
+    using VertexId = GraphVertexId<Graph>;
+    ALGOVAULT_PERF_SCOPE("topological_sort_csr/indegree");
+    const std::size_t V = static_cast<std::size_t>(graph.num_vertices());
+    std::vector<VertexId> indegree(V, 0);
+
+    // Every edge target appears exactly once in the neighbor array
+    for (VertexId v : graph.neighbor_array()) {
+        indegree[v]++;
+    }
+
+    std::vector<VertexId> topo_order;
+    topo_order.reserve(V);
+    for (std::size_t i = 0; i < V; i++) {
+        if (indegree[i] == 0) {
+            topo_order.push_back(static_cast<VertexId>(i));
+        }
+    }
+
+    ALGOVAULT_PERF_NEXT("topological_sort_csr/queue_drain");
+    for (std::size_t head = 0; head < topo_order.size(); head++) {
+        VertexId node = topo_order[head];
+
+        for (VertexId neighbor : graph.neighbors(node)) {
+            if (--indegree[neighbor] == 0) {
+                topo_order.push_back(neighbor);
+            }
+        }
+    }
+
+    // Cycle detection
+    if (topo_order.size() != V) {
+        if (cycle != nullptr) {
+            *cycle = find_cycle(graph.num_vertices(),
+                                [&](VertexId u) { return graph.neighbors(u); });
+        }
+        return {};
+    }
+
+    return topo_order;
+}
+
+/**
+ * Order computed by the compile-time topological sort
+ */
+template <std::size_t V>
+struct StaticTopologicalOrder {
+    std::array<int, V> order{};
+    std::size_t size = 0;  // V, or fewer if the graph has a cycle
+
+    constexpr bool is_dag() const { return size == V; }
+};
+
+/**
+ * Performs topological sort on a small directed graph, also at compile time
+ *
+ * The adjacency is built in fixed-size arrays (CSR: counts, prefix sums,
+ * targets), then Kahn's algorithm runs with the order array as its queue,
+ * so the order is the same as topological_sort(V, adj) with the edges
+ * added to adj in this order.
+ *
+ *     constexpr std::array<std::pair<int, int>, 2> kDependsOn = {{{0, 2}, {2, 1}}};
+ *     constexpr auto kInitOrder = topological_sort<3>(kDependsOn);
+ *     static_assert(kInitOrder.is_dag(), "dependency cycle");
+ *
+ * @param edges: pairs {u, v}: u comes before v, 0 <= u, v < V
+ * @return the order; a graph with a cycle leaves is_dag() false and
+ *         orders only the vertices before the cycle
+ */
+template <std::size_t V, std::size_t E>
+constexpr StaticTopologicalOrder<V> topological_sort(const std::array<std::pair<int, int>, E>& edges) {
+    std::array<std::size_t, V + 1> offsets{};
+    std::array<int, V> indegree{};
+    for (std::size_t e = 0; e < E; e++) {
+        const int u = edges[e].first;
+        const int v = edges[e].second;
+        if (u < 0 || v < 0 || static_cast<std::size_t>(u) >= V || static_cast<std::size_t>(v) >= V) {
+            throw std::out_of_range("topological_sort: edge endpoint out of range");
+        }
+        offsets[static_cast<std::size_t>(u) + 1]++;
+        indegree[static_cast<std::size_t>(v)]++;
+    }
+    for (std::size_t i = 0; i < V; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+    std::array<std::size_t, V> fill{};
+    for (std::size_t i = 0; i < V; i++) {
+        fill[i] = offsets[i];
+    }
+    std::array<int, E> targets{};
+    for (std::size_t e = 0; e < E; e++) {
+        targets[fill[static_cast<std::size_t>(edges[e].first)]++] = edges[e].second;
+    }
+
+    StaticTopologicalOrder<V> result;
+    for (std::size_t i = 0; i < V; i++) {
+        if (indegree[i] == 0) {
+            result.order[result.size++] = static_cast<int>(i);
+        }
+    }
+    for (std::size_t head = 0; head < result.size; head++) {
+        const std::size_t node = static_cast<std::size_t>(result.order[head]);
+        for (std::size_t k = offsets[node]; k < offsets[node + 1]; k++) {
+            const std::size_t neighbor = static_cast<std::size_t>(targets[k]);
+            if (--indegree[neighbor] == 0) {
+                result.order[result.size++] = targets[k];
+            }
+        }
+    }
+    return result;
+}
+
+#endif // ALGOVAULT_SORTING_TOPOLOGICAL_SORT_H